@@ -0,0 +1,211 @@
+#!/usr/bin/env python3
+"""
+Converts images into packed bitmap arrays for UTFT::drawPackedBitmap()
+======================================================================
+
+  bitmap_converter.py [options] image [image ...] > bitmaps.c
+
+Binary PPM (P6) files are read directly, other formats need Pillow.
+
+The palette mode is picked from the number of colors after conversion to
+RGB565: up to 2, 4, 16 or 256 colors give 1, 2, 4 or 8 bits per pixel,
+more give 16 bits per pixel. RLE is used when it makes the array smaller.
+
+Options:
+  --name NAME     name of the array (default: file name without extension,
+                  only if a single image is converted)
+  --bpp N         force 1, 2, 4, 8 or 16 bits per pixel
+  --rle/--no-rle  force RLE on or off
+  --landscape     store the pixels in the order of a landscape window, so
+                  drawPackedBitmap() needs only one window in LANDSCAPE
+"""
+import os
+import sys
+
+BITMAP_COLUMNS = 0x40
+BITMAP_RLE = 0x80
+
+
+def read_ppm(filename):
+    with open(filename, 'rb') as f:
+        data = f.read()
+    fields = []
+    pos = 0
+    while len(fields) < 4:
+        while data[pos:pos + 1].isspace():
+            pos += 1
+        if data[pos:pos + 1] == b'#':
+            pos = data.index(b'\n', pos)
+            continue
+        end = pos
+        while not data[end:end + 1].isspace():
+            end += 1
+        fields.append(data[pos:end])
+        pos = end
+    if fields[0] != b'P6' or int(fields[3]) != 255:
+        raise ValueError('%s: only binary 8 bit PPM files are supported' % filename)
+    width, height = int(fields[1]), int(fields[2])
+    pixels = data[pos + 1:pos + 1 + width * height * 3]
+    return width, height, [tuple(pixels[i:i + 3]) for i in range(0, len(pixels), 3)]
+
+
+def read_image(filename):
+    if filename.lower().endswith('.ppm'):
+        return read_ppm(filename)
+    try:
+        from PIL import Image
+    except ImportError:
+        sys.exit('%s: Pillow is needed for anything but PPM files' % filename)
+    image = Image.open(filename).convert('RGB')
+    return image.size[0], image.size[1], list(image.getdata())
+
+
+def rgb565(rgb):
+    r, g, b = rgb
+    return ((r & 248) << 8) | ((g & 252) << 3) | ((b & 248) >> 3)
+
+
+class BitWriter:
+    def __init__(self, out, bpp):
+        self.out = out
+        self.bpp = bpp
+        self.acc = 0
+        self.bits = 0
+
+    def write(self, value):
+        if self.bpp == 16:
+            self.out += bytes([value >> 8, value & 0xFF])
+            return
+        self.acc = (self.acc << self.bpp) | value
+        self.bits += self.bpp
+        if self.bits == 8:
+            self.flush()
+
+    def flush(self):
+        if self.bits:
+            self.out.append((self.acc << (8 - self.bits)) & 0xFF)
+        self.acc = 0
+        self.bits = 0
+
+
+def encode_raw(values, bpp):
+    out = bytearray()
+    writer = BitWriter(out, bpp)
+    for value in values:
+        writer.write(value)
+    writer.flush()
+    return out
+
+
+def encode_rle(values, bpp):
+    # Runs shorter than this are cheaper as part of a literal packet
+    min_run = 2 if bpp >= 8 else 3
+    out = bytearray()
+    writer = BitWriter(out, bpp)
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            for value in chunk:
+                writer.write(value)
+            writer.flush()
+
+    i = 0
+    while i < len(values):
+        run = 1
+        while i + run < len(values) and run < 128 and values[i + run] == values[i]:
+            run += 1
+        if run >= min_run:
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            writer.write(values[i])
+            writer.flush()
+        else:
+            literal.extend(values[i:i + run])
+        i += run
+    flush_literal()
+    return out
+
+
+def convert(filename, name, bpp, rle, landscape):
+    width, height, rgb = read_image(filename)
+    colors = [rgb565(p) for p in rgb]
+
+    if landscape:
+        colors = [colors[y * width + x] for x in range(width - 1, -1, -1) for y in range(height)]
+
+    palette = sorted(set(colors))
+    if bpp is None:
+        bpp = next((b for b in (1, 2, 4, 8) if len(palette) <= (1 << b)), 16)
+    if bpp != 16 and len(palette) > (1 << bpp):
+        sys.exit('%s: %d colors do not fit into %d bits per pixel' % (filename, len(palette), bpp))
+
+    if bpp == 16:
+        values = colors
+    else:
+        index = dict((c, i) for i, c in enumerate(palette))
+        values = [index[c] for c in colors]
+
+    raw = encode_raw(values, bpp)
+    packed = encode_rle(values, bpp)
+    if rle is None:
+        rle = len(packed) < len(raw)
+
+    header = bytearray([bpp | (BITMAP_COLUMNS if landscape else 0) | (BITMAP_RLE if rle else 0),
+                        width & 0xFF, width >> 8, height & 0xFF, height >> 8])
+    if bpp != 16:
+        header.append(len(palette) - 1)
+        for c in palette:
+            header += bytes([c >> 8, c & 0xFF])
+    data = header + (packed if rle else raw)
+
+    lines = ['// %s: %dx%d, %d bpp%s%s, %d bytes (%d as RGB565)' % (
+        os.path.basename(filename), width, height, bpp, ', RLE' if rle else '',
+        ', landscape order' if landscape else '', len(data), width * height * 2)]
+    lines.append('const unsigned char %s[%d] PROGMEM={' % (name, len(data)))
+    for i in range(0, len(data), 16):
+        lines.append(', '.join('0x%02X' % b for b in data[i:i + 16]) + ',')
+    lines.append('};')
+    return '\n'.join(lines) + '\n'
+
+
+def main(argv):
+    name = None
+    bpp = None
+    rle = None
+    landscape = False
+    files = []
+
+    args = iter(argv)
+    for arg in args:
+        if arg == '--name':
+            name = next(args)
+        elif arg == '--bpp':
+            bpp = int(next(args))
+            if bpp not in (1, 2, 4, 8, 16):
+                sys.exit('--bpp has to be 1, 2, 4, 8 or 16')
+        elif arg == '--rle':
+            rle = True
+        elif arg == '--no-rle':
+            rle = False
+        elif arg == '--landscape':
+            landscape = True
+        elif arg.startswith('--'):
+            sys.exit(__doc__)
+        else:
+            files.append(arg)
+
+    if not files or (name is not None and len(files) > 1):
+        sys.exit(__doc__)
+
+    print('#if defined(__AVR__)\n\t#include <avr/pgmspace.h>\n#elif !defined(PROGMEM)\n\t#define PROGMEM\n#endif\n')
+    for filename in files:
+        array = name or os.path.splitext(os.path.basename(filename))[0].replace('-', '_').replace(' ', '_')
+        print(convert(filename, array, bpp, rle, landscape))
+
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -41,7 +41,9 @@
 #include <pins_arduino.h>
 
 // Include hardware-specific functions for the correct MCU
-#if defined(__AVR__)
+#if defined(UTFT_HOST_SIM)
+	#include "hardware/sim/HW_SIM.h"
+#elif defined(__AVR__)
 	#include <avr/pgmspace.h>
 	#include "hardware/avr/HW_AVR.h"
 	#if defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
@@ -85,6 +87,52 @@
 #endif
 #include "memorysaver.h"
 
+#if defined(UTFT_BUS_STATS)
+	#define _stat_com()		bus_stats.com++
+	#define _stat_data(n)	bus_stats.data+=(n)
+#else
+	#define _stat_com()
+	#define _stat_data(n)
+#endif
+
+// Scale of _sin_table
+#define SIN_SHIFT	14
+#define SIN_ONE		16384
+
+// Sector modes of _arc_sector, directions are scaled by ARC_ONE
+#define ARC_FULL	0
+#define ARC_NARROW	1	// up to 180 degrees, inside both half planes
+#define ARC_WIDE	2	// more than 180 degrees, inside either half plane
+#define ARC_EMPTY	3
+#define ARC_ONE		SIN_ONE
+
+// Packed bitmaps, see drawPackedBitmap()
+#define BITMAP_BPP		0x1F
+#define BITMAP_COLUMNS	0x40
+#define BITMAP_RLE		0x80
+
+// Outcodes of _clip_code()
+#define CLIP_LEFT	1
+#define CLIP_RIGHT	2
+#define CLIP_TOP	4
+#define CLIP_BOTTOM	8
+
+// Display list ops, see beginList()
+#define DL_RECT		1		// x1, y1, x2, y2, color
+#define DL_LINE		2		// x1, y1, x2, y2, clip x1, y1, x2, y2, color
+#define DL_DROPPED	0x80
+
+// Clip state of a streaming write, see _begin_write()
+#define WR_INSIDE	0
+#define WR_PARTIAL	1
+#define WR_OUTSIDE	2
+
+#if defined(UTFT_AUTO_CLRXY)
+	#define _auto_clrXY()	{ cbi(P_CS, B_CS); clrXY(); sbi(P_CS, B_CS); }
+#else
+	#define _auto_clrXY()
+#endif
+
 UTFT::UTFT()
 {
 }
@@ -95,6 +143,10 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 	word	dsy[] = {319, 399, 319, 319, 319, 319, 219, 219, 399, 159, 127, 319, 479, 799, 319, 319, 319, 0, 0, 319, 799, 479, 319, 219, 159, 319, 319, 479, 479, 479, 159, 159};
 	byte	dtm[] = {16, 16, 16, 8, 8, 16, 8, SERIAL_4PIN, 16, SERIAL_5PIN, SERIAL_5PIN, 16, 16, 16, 8, 16, LATCHED_16, 0, 0, 8, 16, 16, 16, 8, SERIAL_5PIN, SERIAL_5PIN, SERIAL_4PIN, 16, 16, 16, SERIAL_5PIN, SERIAL_5PIN};
 
+	band.buf = NULL;
+	dlist.buf = NULL;
+	dlist.recorded = 0;
+	dlist.replayed = 0;
 	disp_x_size =			dsx[model];
 	disp_y_size =			dsy[model];
 	display_transfer_mode =	dtm[model];
@@ -160,6 +212,7 @@ UTFT::UTFT(byte model, int RS, int WR, int CS, int RST, int SER)
 
 void UTFT::LCD_Write_COM(char VL)  
 {   
+	_stat_com();
 	if (display_transfer_mode!=1)
 	{
 		cbi(P_RS, B_RS);
@@ -171,6 +224,12 @@ void UTFT::LCD_Write_COM(char VL)
 
 void UTFT::LCD_Write_DATA(char VH,char VL)
 {
+	if (band.buf!=NULL)
+	{
+		_band_fill(VH, VL, 1);
+		return;
+	}
+	_stat_data(1);
 	if (display_transfer_mode!=1)
 	{
 		sbi(P_RS, B_RS);
@@ -185,6 +244,7 @@ void UTFT::LCD_Write_DATA(char VH,char VL)
 
 void UTFT::LCD_Write_DATA(char VL)
 {
+	_stat_data(1);
 	if (display_transfer_mode!=1)
 	{
 		sbi(P_RS, B_RS);
@@ -222,6 +282,7 @@ void UTFT::InitLCD(byte orientation)
 	sbi(P_RST, B_RST);
 	delay(15);
 
+	invalidateXY();
 	cbi(P_CS, B_CS);
 
 	switch(display_model)
@@ -307,15 +368,35 @@ void UTFT::InitLCD(byte orientation)
 	}
 
 	sbi (P_CS, B_CS); 
+	invalidateXY();
+
+	clip.x1=0;
+	clip.y1=0;
+	clip.x2=getDisplayXSize()-1;
+	clip.y2=getDisplayYSize()-1;
+	clip_depth=0;
+	scroll_first=0;
+	scroll_last=-1;
 
 	setColor(255, 255, 255);
 	setBackColor(0, 0, 0);
 	cfont.font=0;
 	_transparent = false;
+#if defined(UTFT_BUS_STATS)
+	resetBusStats();
+#endif
 }
 
 void UTFT::setXY(word x1, word y1, word x2, word y2)
 {
+	// Anything but the recorded ops sends the display list first. The
+	// caller has selected the display, so it is selected again afterwards.
+	if ((dlist.buf!=NULL) and (dlist.len>0))
+	{
+		_dl_flush();
+		cbi(P_CS, B_CS);
+	}
+
 	if (orient==LANDSCAPE)
 	{
 		swap(word, x1, y1);
@@ -325,6 +406,30 @@ void UTFT::setXY(word x1, word y1, word x2, word y2)
 		swap(word, y1, y2)
 	}
 
+	// While a band is active the window only selects where the following
+	// pixels go in the band, nothing is sent to the controller
+	if (band.buf!=NULL)
+	{
+		band.wx1=band.wx=x1;
+		band.wy1=band.wy=y1;
+		band.wx2=x2;
+		band.wy2=y2;
+		return;
+	}
+
+	// Window cache: the setxy code of most controllers only sends the
+	// window registers in the set_* flags. The cursor is always sent.
+	boolean	set_x1=(!win_valid) or (x1!=win_x1);
+	boolean	set_y1=(!win_valid) or (y1!=win_y1);
+	boolean	set_x2=(!win_valid) or (x2!=win_x2);
+	boolean	set_y2=(!win_valid) or (y2!=win_y2);
+
+	win_x1=x1;
+	win_y1=y1;
+	win_x2=x2;
+	win_y2=y2;
+	win_valid=true;
+
 	switch(display_model)
 	{
 #ifndef DISABLE_HX8347A
@@ -416,6 +521,13 @@ void UTFT::clrXY()
 		setXY(0,0,disp_y_size,disp_x_size);
 }
 
+// Has to be called when the window registers have been written without
+// setXY(), or when setXY() was called while CS was high
+void UTFT::invalidateXY()
+{
+	win_valid=false;
+}
+
 void UTFT::drawRect(int x1, int y1, int x2, int y2)
 {
 	if (x1>x2)
@@ -466,12 +578,27 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2)
 	{
 		swap(int, y1, y2);
 	}
-	if (display_transfer_mode==16)
+	if (!_clip_rect(&x1, &y1, &x2, &y2))
+		return;
+	if (dlist.buf!=NULL)
+	{
+		int	v[4]={x1, y1, x2, y2};
+
+		if (_dl_add(DL_RECT, v))
+			return;
+	}
+	if (band.buf!=NULL)
+	{
+		setXY(x1, y1, x2, y2);
+		_band_fill(fch,fcl,((long(x2-x1)+1)*(long(y2-y1)+1)));
+	}
+	else if (display_transfer_mode==16)
 	{
 		cbi(P_CS, B_CS);
 		setXY(x1, y1, x2, y2);
 		sbi(P_RS, B_RS);
 		_fast_fill_16(fch,fcl,((long(x2-x1)+1)*(long(y2-y1)+1)));
+		_stat_data((long(x2-x1)+1)*(long(y2-y1)+1));
 		sbi(P_CS, B_CS);
 	}
 	else if ((display_transfer_mode==8) and (fch==fcl))
@@ -480,6 +607,24 @@ void UTFT::fillRect(int x1, int y1, int x2, int y2)
 		setXY(x1, y1, x2, y2);
 		sbi(P_RS, B_RS);
 		_fast_fill_8(fch,((long(x2-x1)+1)*(long(y2-y1)+1)));
+		_stat_data((long(x2-x1)+1)*(long(y2-y1)+1));
+		sbi(P_CS, B_CS);
+	}
+	else if (display_transfer_mode==8)
+	{
+		cbi(P_CS, B_CS);
+		setXY(x1, y1, x2, y2);
+		sbi(P_RS, B_RS);
+		_fast_fill_8x2(fch,fcl,((long(x2-x1)+1)*(long(y2-y1)+1)));
+		_stat_data((long(x2-x1)+1)*(long(y2-y1)+1));
+		sbi(P_CS, B_CS);
+	}
+	else if (display_transfer_mode==1)
+	{
+		cbi(P_CS, B_CS);
+		setXY(x1, y1, x2, y2);
+		_fast_fill_serial(fch,fcl,((long(x2-x1)+1)*(long(y2-y1)+1)));
+		_stat_data((long(x2-x1)+1)*(long(y2-y1)+1));
 		sbi(P_CS, B_CS);
 	}
 	else
@@ -538,64 +683,302 @@ void UTFT::fillRoundRect(int x1, int y1, int x2, int y2)
 
 void UTFT::drawCircle(int x, int y, int radius)
 {
-	int f = 1 - radius;
-	int ddF_x = 1;
-	int ddF_y = -2 * radius;
-	int x1 = 0;
-	int y1 = radius;
- 
+	_circle_outline(x, y, radius, 0);
+	_auto_clrXY();
+}
+
+void UTFT::fillCircle(int x, int y, int radius)
+{
+	_annulus_fill(x, y, 0, radius, 0);
+	_auto_clrXY();
+}
+
+// Angles are in degrees, clockwise with 0 at 12 o'clock. The arc runs
+// clockwise from startAngle to endAngle.
+void UTFT::drawArc(int x, int y, int radius, int startAngle, int endAngle)
+{
+	_arc_sector	sector;
+
+	_arc_setup(&sector, startAngle, endAngle);
+	_circle_outline(x, y, radius, &sector);
+	_auto_clrXY();
+}
+
+void UTFT::drawAnnulus(int x, int y, int innerRadius, int outerRadius, int startAngle, int endAngle)
+{
+	_arc_sector	sector;
+
+	_arc_setup(&sector, startAngle, endAngle);
+	if (innerRadius>0)
+		_circle_outline(x, y, innerRadius, &sector);
+	_circle_outline(x, y, outerRadius, &sector);
+	if (sector.mode!=ARC_FULL)
+	{
+		drawLine(x+(innerRadius*sector.sx)/ARC_ONE, y+(innerRadius*sector.sy)/ARC_ONE, x+(outerRadius*sector.sx)/ARC_ONE, y+(outerRadius*sector.sy)/ARC_ONE);
+		drawLine(x+(innerRadius*sector.ex)/ARC_ONE, y+(innerRadius*sector.ey)/ARC_ONE, x+(outerRadius*sector.ex)/ARC_ONE, y+(outerRadius*sector.ey)/ARC_ONE);
+	}
+	_auto_clrXY();
+}
+
+// Fills the ring between the outlines of innerRadius and outerRadius
+// (both included). An innerRadius of 0 gives a filled circle or pie.
+void UTFT::fillAnnulus(int x, int y, int innerRadius, int outerRadius, int startAngle, int endAngle)
+{
+	_arc_sector	sector;
+
+	_arc_setup(&sector, startAngle, endAngle);
+	_annulus_fill(x, y, innerRadius, outerRadius, &sector);
+	_auto_clrXY();
+}
+
+// sin() of 0 to 90 degrees, scaled by SIN_ONE
+static const uint16_t _sin_table[91] PROGMEM = {
+	0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+	2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+	5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+	8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+	10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+	12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+	14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+	15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+	16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+	16384
+};
+
+// sin() and cos() of a whole number of degrees, scaled by SIN_ONE
+static long _isin(long deg)
+{
+	deg=((deg % 360) + 360) % 360;
+	if (deg>=180)
+		return -_isin(deg-180);
+	if (deg>90)
+		deg=180-deg;
+	return pgm_read_word(&_sin_table[deg]);
+}
+
+static long _icos(long deg)
+{
+	return _isin(deg+90);
+}
+
+void UTFT::_arc_setup(_arc_sector *sector, int startAngle, int endAngle)
+{
+	long	sweep = long(endAngle) - startAngle;
+
+	if ((sweep>=360) or (sweep<=-360))
+		sector->mode = ARC_FULL;
+	else
+	{
+		sweep = ((sweep % 360) + 360) % 360;
+		if (sweep==0)
+			sector->mode = ARC_EMPTY;
+		else if (sweep<=180)
+			sector->mode = ARC_NARROW;
+		else
+			sector->mode = ARC_WIDE;
+	}
+
+	sector->sx = _isin(startAngle);
+	sector->sy = -_icos(startAngle);
+	sector->ex = _isin(endAngle);
+	sector->ey = -_icos(endAngle);
+}
+
+// Range of u with a*t - b*u >= 0 (ge) or <= 0 (!ge)
+static void _arc_half_line(long a, long b, int t, boolean ge, long *lo, long *hi)
+{
+	long	n = a*t;
+
+	*lo = -32768;
+	*hi = 32767;
+	if (!ge)
+	{
+		n = -n;
+		b = -b;
+	}
+	if (b==0)
+	{
+		if (n<0)
+		{
+			*lo = 32767;
+			*hi = -32768;
+		}
+	}
+	else if (b>0)
+		*hi = (n>=0) ? n/b : -((-n+b-1)/b);
+	else
+		*lo = (n<=0) ? (-n)/(-b) + (((-n)%(-b))!=0) : -(n/(-b));
+}
+
+// Draws the pixels t, u1..u2 (relative to x, y) that are inside the sector.
+// The span is a row (t=dy) or, if vertical, a column (t=dx). CS must be low.
+void UTFT::_arc_span(_arc_sector *sector, int x, int y, boolean vertical, int t, int u1, int u2)
+{
+	long	lo[2], hi[2];
+	int		n = 1;
+
+	lo[0] = u1;
+	hi[0] = u2;
+	if ((sector!=0) and (sector->mode!=ARC_FULL))
+	{
+		long	alo, ahi, blo, bhi;
+
+		if (sector->mode==ARC_EMPTY)
+			return;
+
+		// Clockwise from the start direction: cross(s, p) >= 0,
+		// counterclockwise from the end direction: cross(e, p) <= 0
+		if (vertical)
+		{
+			_arc_half_line(sector->sy, sector->sx, t, false, &alo, &ahi);
+			_arc_half_line(sector->ey, sector->ex, t, true, &blo, &bhi);
+		}
+		else
+		{
+			_arc_half_line(sector->sx, sector->sy, t, true, &alo, &ahi);
+			_arc_half_line(sector->ex, sector->ey, t, false, &blo, &bhi);
+		}
+
+		if (sector->mode==ARC_NARROW)
+		{
+			lo[0] = max(long(u1), max(alo, blo));
+			hi[0] = min(long(u2), min(ahi, bhi));
+		}
+		else
+		{
+			lo[0] = max(long(u1), alo);
+			hi[0] = min(long(u2), ahi);
+			lo[1] = max(long(u1), blo);
+			hi[1] = min(long(u2), bhi);
+			n = 2;
+			if ((lo[0]<=hi[0]) and (lo[1]<=hi[1]) and (lo[1]<=hi[0]+1) and (lo[0]<=hi[1]+1))
+			{
+				// Overlapping or adjacent, draw as one span
+				lo[0] = min(lo[0], lo[1]);
+				hi[0] = max(hi[0], hi[1]);
+				n = 1;
+			}
+		}
+	}
+
+	for (int i=0; i<n; i++)
+		if (lo[i]<=hi[i])
+		{
+			int		x1=x+lo[i], y1=y+t, x2=x+hi[i], y2=y+t;
+
+			if (vertical)
+			{
+				x1=x2=x+t;
+				y1=y+lo[i];
+				y2=y+hi[i];
+			}
+			if (_clip_rect(&x1, &y1, &x2, &y2))
+			{
+				setXY(x1, y1, x2, y2);
+				_fast_fill(long(x2-x1+1)*(y2-y1+1));
+			}
+		}
+}
+
+// Midpoint circle. The points of one octant that share a row are drawn
+// as one run, and the same run is mirrored into the other octants.
+void UTFT::_circle_outline(int x, int y, int radius, _arc_sector *sector)
+{
+	int		f = 1 - radius;
+	int		ddF_x = 1;
+	int		ddF_y = -2 * radius;
+	int		x1 = 0;
+	int		y1 = radius;
+	int		start = 0;
+
 	cbi(P_CS, B_CS);
-	setXY(x, y + radius, x, y + radius);
-	LCD_Write_DATA(fch,fcl);
-	setXY(x, y - radius, x, y - radius);
-	LCD_Write_DATA(fch,fcl);
-	setXY(x + radius, y, x + radius, y);
-	LCD_Write_DATA(fch,fcl);
-	setXY(x - radius, y, x - radius, y);
-	LCD_Write_DATA(fch,fcl);
- 
-	while(x1 < y1)
-	{
-		if(f >= 0) 
+	while (true)
+	{
+		boolean	last = (x1 >= y1);
+
+		if ((f >= 0) or last)
 		{
+			// Run start..x1 at distance y1 from the center
+			if (start==0)
+			{
+				_arc_span(sector, x, y, false, y1, -x1, x1);
+				if (y1!=0)
+					_arc_span(sector, x, y, false, -y1, -x1, x1);
+				if (y1!=0)
+				{
+					_arc_span(sector, x, y, true, y1, -x1, x1);
+					_arc_span(sector, x, y, true, -y1, -x1, x1);
+				}
+			}
+			else
+			{
+				_arc_span(sector, x, y, false, y1, start, x1);
+				_arc_span(sector, x, y, false, y1, -x1, -start);
+				_arc_span(sector, x, y, false, -y1, start, x1);
+				_arc_span(sector, x, y, false, -y1, -x1, -start);
+				_arc_span(sector, x, y, true, y1, start, x1);
+				_arc_span(sector, x, y, true, y1, -x1, -start);
+				_arc_span(sector, x, y, true, -y1, start, x1);
+				_arc_span(sector, x, y, true, -y1, -x1, -start);
+			}
+			if (last)
+				break;
 			y1--;
 			ddF_y += 2;
 			f += ddF_y;
+			start = x1 + 1;
 		}
 		x1++;
 		ddF_x += 2;
-		f += ddF_x;    
-		setXY(x + x1, y + y1, x + x1, y + y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - x1, y + y1, x - x1, y + y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x + x1, y - y1, x + x1, y - y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - x1, y - y1, x - x1, y - y1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x + y1, y + x1, x + y1, y + x1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - y1, y + x1, x - y1, y + x1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x + y1, y - x1, x + y1, y - x1);
-		LCD_Write_DATA(fch,fcl);
-		setXY(x - y1, y - x1, x - y1, y - x1);
-		LCD_Write_DATA(fch,fcl);
+		f += ddF_x;
 	}
 	sbi(P_CS, B_CS);
-	clrXY();
 }
 
-void UTFT::fillCircle(int x, int y, int radius)
+// One span (two inside the inner circle) per scanline. The decision of
+// _circle_outline() puts a pixel inside the circle if
+// x^2 + y^2 - max(x, y) < r^2, so using the same test here gives filled
+// circles whose edge is exactly the outline. q = r^2 - y^2 and xx = x^2
+// are kept up to date incrementally.
+void UTFT::_annulus_fill(int x, int y, int innerRadius, int outerRadius, _arc_sector *sector)
 {
-	for(int y1=-radius; y1<=0; y1++) 
-		for(int x1=-radius; x1<=0; x1++)
-			if(x1*x1+y1*y1 <= radius*radius) 
+	int		xo = outerRadius, xi = innerRadius - 1;
+	long	qo = long(xo)*xo, xxo = qo;
+	long	qi = long(xi)*xi, xxi = qi;
+
+	cbi(P_CS, B_CS);
+	for (int dy=0; dy<=outerRadius; dy++)
+	{
+		if (dy>0)
+		{
+			qo -= 2*dy - 1;
+			qi -= 2*dy - 1;
+		}
+		while ((xo>0) and (xxo - max(xo, dy) >= qo))
+		{
+			xo--;
+			xxo -= 2*xo + 1;
+		}
+		while ((xi>0) and (xxi - max(xi, dy) >= qi))
+		{
+			xi--;
+			xxi -= 2*xi + 1;
+		}
+
+		for (int side=0; side<((dy==0) ? 1 : 2); side++)
+		{
+			int	row = (side==0) ? dy : -dy;
+
+			if ((innerRadius<=0) or (dy>=innerRadius))
+				_arc_span(sector, x, y, false, row, -xo, xo);
+			else if (xi<xo)
 			{
-				drawHLine(x+x1, y+y1, 2*(-x1));
-				drawHLine(x+x1, y-y1, 2*(-x1));
-				break;
+				_arc_span(sector, x, y, false, row, -xo, -xi - 1);
+				_arc_span(sector, x, y, false, row, xi + 1, xo);
 			}
+		}
+	}
+	sbi(P_CS, B_CS);
 }
 
 void UTFT::clrScr()
@@ -606,23 +989,20 @@ void UTFT::clrScr()
 	clrXY();
 	if (display_transfer_mode!=1)
 		sbi(P_RS, B_RS);
-	if (display_transfer_mode==16)
+	if (band.buf!=NULL)
+		_band_fill(0,0,((disp_x_size+1)*(disp_y_size+1)));
+	else if (display_transfer_mode==16)
 		_fast_fill_16(0,0,((disp_x_size+1)*(disp_y_size+1)));
 	else if (display_transfer_mode==8)
 		_fast_fill_8(0,((disp_x_size+1)*(disp_y_size+1)));
+	else if (display_transfer_mode==1)
+		_fast_fill_serial(0,0,((disp_x_size+1)*(disp_y_size+1)));
 	else
 	{
 		for (i=0; i<((disp_x_size+1)*(disp_y_size+1)); i++)
-		{
-			if (display_transfer_mode!=1)
-				LCD_Writ_Bus(0,0,display_transfer_mode);
-			else
-			{
-				LCD_Writ_Bus(1,0,display_transfer_mode);
-				LCD_Writ_Bus(1,0,display_transfer_mode);
-			}
-		}
+			LCD_Writ_Bus(0,0,display_transfer_mode);
 	}
+	_stat_data((disp_x_size+1)*(disp_y_size+1));
 	sbi(P_CS, B_CS);
 }
 
@@ -644,23 +1024,22 @@ void UTFT::fillScr(word color)
 	clrXY();
 	if (display_transfer_mode!=1)
 		sbi(P_RS, B_RS);
-	if (display_transfer_mode==16)
+	if (band.buf!=NULL)
+		_band_fill(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
+	else if (display_transfer_mode==16)
 		_fast_fill_16(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
 	else if ((display_transfer_mode==8) and (ch==cl))
 		_fast_fill_8(ch,((disp_x_size+1)*(disp_y_size+1)));
+	else if (display_transfer_mode==8)
+		_fast_fill_8x2(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
+	else if (display_transfer_mode==1)
+		_fast_fill_serial(ch,cl,((disp_x_size+1)*(disp_y_size+1)));
 	else
 	{
 		for (i=0; i<((disp_x_size+1)*(disp_y_size+1)); i++)
-		{
-			if (display_transfer_mode!=1)
-				LCD_Writ_Bus(ch,cl,display_transfer_mode);
-			else
-			{
-				LCD_Writ_Bus(1,ch,display_transfer_mode);
-				LCD_Writ_Bus(1,cl,display_transfer_mode);
-			}
-		}
+			LCD_Writ_Bus(ch,cl,display_transfer_mode);
 	}
+	_stat_data((disp_x_size+1)*(disp_y_size+1));
 	sbi(P_CS, B_CS);
 }
 
@@ -705,6 +1084,33 @@ word UTFT::getBackColor()
 	return (bch<<8) | bcl;
 }
 
+// Fills table with levels colors from fg (index 0) to bg (index levels-1)
+// in equal steps, e.g. for anti-aliased edges. The channels are stepped in
+// 8.8 fixed point, so building the table costs three divisions and looking
+// up a blended pixel costs nothing but the index.
+void UTFT::makeBlendTable(word *table, byte levels, word fg, word bg)
+{
+	int		r=(fg>>11)<<8, g=((fg>>5)&63)<<8, b=(fg&31)<<8;
+	int		dr=0, dg=0, db=0;
+
+	if (levels==0)
+		return;
+	if (levels>1)
+	{
+		dr=(int(bg>>11)-int(fg>>11))*256/(levels-1);
+		dg=(int((bg>>5)&63)-int((fg>>5)&63))*256/(levels-1);
+		db=(int(bg&31)-int(fg&31))*256/(levels-1);
+	}
+	for (byte i=0; i<levels-1; i++)
+	{
+		table[i]=(word((r+128)>>8)<<11) | (word((g+128)>>8)<<5) | word((b+128)>>8);
+		r+=dr;
+		g+=dg;
+		b+=db;
+	}
+	table[levels-1]=bg;
+}
+
 void UTFT::setPixel(word color)
 {
 	LCD_Write_DATA((color>>8),(color&0xFF));	// rrrrrggggggbbbbb
@@ -712,14 +1118,129 @@ void UTFT::setPixel(word color)
 
 void UTFT::drawPixel(int x, int y)
 {
+	if (_clip_code(x, y)!=0)
+		return;
+	if (dlist.buf!=NULL)
+	{
+		int	v[4]={x, y, x, y};
+
+		if (_dl_add(DL_RECT, v))
+			return;
+	}
 	cbi(P_CS, B_CS);
 	setXY(x, y, x, y);
 	setPixel((fch<<8)|fcl);
 	sbi(P_CS, B_CS);
-	clrXY();
+	_auto_clrXY();
 }
 
 void UTFT::drawLine(int x1, int y1, int x2, int y2)
+{
+	if (y1==y2)
+		drawHLine(x1, y1, x2-x1);
+	else if (x1==x2)
+		drawVLine(x1, y1, y2-y1);
+	else if ((_clip_code(x1, y1) & _clip_code(x2, y2))==0)
+	{
+		if (dlist.buf!=NULL)
+		{
+			int	v[8]={x1, y1, x2, y2, clip.x1, clip.y1, clip.x2, clip.y2};
+
+			if (_dl_add(DL_LINE, v))
+				return;
+		}
+
+		// Lines with both ends on the same outer side of the clip
+		// rectangle are rejected above, the rest is clipped while walking
+		cbi(P_CS, B_CS);
+		if (abs(long(x2)-x1) < abs(long(y2)-y1))
+			_line_runs(y1, x1, y2, x2, true);
+		else
+			_line_runs(x1, y1, x2, y2, false);
+		sbi(P_CS, B_CS);
+	}
+	_auto_clrXY();
+}
+
+// Bresenham walk along the major axis u (y if steep, else x) from u1,v1
+// to u2,v2. The pixels are collected into runs along u, each run gets one
+// window and a single fill. Only the steps inside the clip range of u are
+// walked: the walk starts at the first of them with the minor position and
+// error term it would have reached from u1, so the pixels are exactly the
+// ones of the unclipped line. Runs outside the clip range of v are skipped.
+void UTFT::_line_runs(int u1, int v1, int u2, int v2, boolean steep)
+{
+	unsigned long	du=abs(long(u2)-u1), dv=abs(long(v2)-v1);
+	int				us=(u2>u1) ? 1 : -1, vs=(v2>v1) ? 1 : -1;
+	int				cu1=steep ? clip.y1 : clip.x1, cu2=steep ? clip.y2 : clip.x2;
+	int				cv1=steep ? clip.x1 : clip.y1, cv2=steep ? clip.x2 : clip.y2;
+	long			k0, k1;
+	unsigned long	r, c;
+
+	if (us>0)
+	{
+		k0=max(0L, long(cu1)-u1);
+		k1=min(long(du), long(cu2)-u1);
+	}
+	else
+	{
+		k0=max(0L, long(u1)-cu2);
+		k1=min(long(du), long(u1)-cu1);
+	}
+	if (k0>k1)
+		return;
+
+	// r is the error term + du, v steps whenever it reaches du
+	if (k0==0)
+	{
+		c=0;
+		r=du-(du>>1);
+	}
+	else
+	{
+		// v steps at most once per step of u, the start value du of
+		// r for du==1 would count one step more
+		r=k0*dv+du-(du>>1);
+		c=min(r/du, (unsigned long)k0);
+		r%=du;
+	}
+
+	int		u=u1+us*int(k0), v=v1+vs*int(c), start=u;
+
+	for (long k=k0; k<=k1; k++, u+=us)
+	{
+		boolean	step=false;
+
+		if (k<k1)
+		{
+			r+=dv;
+			if (r>=du)
+			{
+				r-=du;
+				step=true;
+			}
+		}
+		if ((k==k1) or step)
+		{
+			if ((v>=cv1) and (v<=cv2))
+			{
+				if (steep)
+					setXY(v, min(start, u), v, max(start, u));
+				else
+					setXY(min(start, u), v, max(start, u), v);
+				_fast_fill(long(abs(u-start))+1);
+			}
+			start=u+us;
+			v+=vs;
+		}
+	}
+}
+
+// Original per-pixel line path. Every pixel gets its own window, which
+// makes it a useful reference when comparing bus costs (see bus_stats).
+// The walk ends with CS high. The clrXY() after it is ignored by the
+// controller, so the window cache is invalidated afterwards.
+void UTFT::_draw_line_pixels(int x1, int y1, int x2, int y2)
 {
 	if (y1==y2)
 		drawHLine(x1, y1, x2-x1);
@@ -742,7 +1263,7 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 				setXY (col, row, col, row);
 				LCD_Write_DATA (fch, fcl);
 				if (row == y2)
-					return;
+					break;
 				row += ystep;
 				t += dx;
 				if (t >= 0)
@@ -760,7 +1281,7 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 				setXY (col, row, col, row);
 				LCD_Write_DATA (fch, fcl);
 				if (col == x2)
-					return;
+					break;
 				col += xstep;
 				t += dy;
 				if (t >= 0)
@@ -773,6 +1294,7 @@ void UTFT::drawLine(int x1, int y1, int x2, int y2)
 		sbi(P_CS, B_CS);
 	}
 	clrXY();
+	invalidateXY();
 }
 
 void UTFT::drawHLine(int x, int y, int l)
@@ -782,17 +1304,45 @@ void UTFT::drawHLine(int x, int y, int l)
 		l = -l;
 		x -= l;
 	}
+
+	int		x2=x+l, y2=y;
+
+	if (!_clip_rect(&x, &y, &x2, &y2))
+		return;
+	l=x2-x;
+	if (dlist.buf!=NULL)
+	{
+		int	v[4]={x, y, x2, y2};
+
+		if (_dl_add(DL_RECT, v))
+			return;
+	}
 	cbi(P_CS, B_CS);
 	setXY(x, y, x+l, y);
-	if (display_transfer_mode == 16)
+	if (band.buf!=NULL)
+		_band_fill(fch,fcl,l+1);
+	else if (display_transfer_mode == 16)
 	{
 		sbi(P_RS, B_RS);
-		_fast_fill_16(fch,fcl,l);
+		_fast_fill_16(fch,fcl,l+1);
+		_stat_data(l+1);
 	}
 	else if ((display_transfer_mode==8) and (fch==fcl))
 	{
 		sbi(P_RS, B_RS);
-		_fast_fill_8(fch,l);
+		_fast_fill_8(fch,l+1);
+		_stat_data(l+1);
+	}
+	else if (display_transfer_mode==8)
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_8x2(fch,fcl,l+1);
+		_stat_data(l+1);
+	}
+	else if (display_transfer_mode==1)
+	{
+		_fast_fill_serial(fch,fcl,l+1);
+		_stat_data(l+1);
 	}
 	else
 	{
@@ -802,7 +1352,7 @@ void UTFT::drawHLine(int x, int y, int l)
 		}
 	}
 	sbi(P_CS, B_CS);
-	clrXY();
+	_auto_clrXY();
 }
 
 void UTFT::drawVLine(int x, int y, int l)
@@ -812,17 +1362,45 @@ void UTFT::drawVLine(int x, int y, int l)
 		l = -l;
 		y -= l;
 	}
+
+	int		x2=x, y2=y+l;
+
+	if (!_clip_rect(&x, &y, &x2, &y2))
+		return;
+	l=y2-y;
+	if (dlist.buf!=NULL)
+	{
+		int	v[4]={x, y, x2, y2};
+
+		if (_dl_add(DL_RECT, v))
+			return;
+	}
 	cbi(P_CS, B_CS);
 	setXY(x, y, x, y+l);
-	if (display_transfer_mode == 16)
+	if (band.buf!=NULL)
+		_band_fill(fch,fcl,l+1);
+	else if (display_transfer_mode == 16)
 	{
 		sbi(P_RS, B_RS);
-		_fast_fill_16(fch,fcl,l);
+		_fast_fill_16(fch,fcl,l+1);
+		_stat_data(l+1);
 	}
 	else if ((display_transfer_mode==8) and (fch==fcl))
 	{
 		sbi(P_RS, B_RS);
-		_fast_fill_8(fch,l);
+		_fast_fill_8(fch,l+1);
+		_stat_data(l+1);
+	}
+	else if (display_transfer_mode==8)
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_8x2(fch,fcl,l+1);
+		_stat_data(l+1);
+	}
+	else if (display_transfer_mode==1)
+	{
+		_fast_fill_serial(fch,fcl,l+1);
+		_stat_data(l+1);
 	}
 	else
 	{
@@ -832,131 +1410,287 @@ void UTFT::drawVLine(int x, int y, int l)
 		}
 	}
 	sbi(P_CS, B_CS);
-	clrXY();
+	_auto_clrXY();
+}
+
+void UTFT::_fast_fill(long pix)
+{
+	if (band.buf!=NULL)
+		_band_fill(fch,fcl,pix);
+	else if (display_transfer_mode==16)
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_16(fch,fcl,pix);
+		_stat_data(pix);
+	}
+	else if ((display_transfer_mode==8) and (fch==fcl))
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_8(fch,pix);
+		_stat_data(pix);
+	}
+	else if (display_transfer_mode==8)
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_8x2(fch,fcl,pix);
+		_stat_data(pix);
+	}
+	else if (display_transfer_mode==1)
+	{
+		_fast_fill_serial(fch,fcl,pix);
+		_stat_data(pix);
+	}
+	else
+	{
+		for (long i=0; i<pix; i++)
+			LCD_Write_DATA(fch, fcl);
+	}
 }
 
 void UTFT::printChar(byte c, int x, int y)
 {
-	byte i,ch;
-	word j;
-	word temp; 
+	byte	bw=cfont.x_size/8;
+	byte	xs=cfont.x_size, ys=cfont.y_size;
+	word	temp=((c-cfont.offset)*(bw*ys))+4;
+	word	fg=(fch<<8)|fcl;
+	word	bg=(bch<<8)|bcl;
 
 	cbi(P_CS, B_CS);
-  
-	if (!_transparent)
+
+	if ((!_transparent) and ((_clip_code(x, y) | _clip_code(x+xs-1, y+ys-1))==0))
 	{
+		setXY(x,y,x+xs-1,y+ys-1);
+		if (display_transfer_mode!=1)
+			sbi(P_RS, B_RS);
 		if (orient==PORTRAIT)
 		{
-			setXY(x,y,x+cfont.x_size-1,y+cfont.y_size-1);
-	  
-			temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-			for(j=0;j<((cfont.x_size/8)*cfont.y_size);j++)
-			{
-				ch=pgm_read_byte(&cfont.font[temp]);
-				for(i=0;i<8;i++)
-				{   
-					if((ch&(1<<(7-i)))!=0)   
-					{
-						setPixel((fch<<8)|fcl);
-					} 
-					else
-					{
-						setPixel((bch<<8)|bcl);
-					}   
-				}
-				temp++;
-			}
+			// The window is filled in reading order, so the glyph bytes
+			// are sent as stored, MSB first
+			for (word j=0; j<bw*ys; j++)
+				_glyph_bits(pgm_read_byte(&cfont.font[temp+j]), 8, fg, bg);
 		}
 		else
 		{
-			temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-
-			for(j=0;j<((cfont.x_size/8)*cfont.y_size);j+=(cfont.x_size/8))
+			// In landscape the window is filled column by column, starting
+			// with the rightmost column of the glyph
+			for (int col=xs-1; col>=0; col--)
 			{
-				setXY(x,y+(j/(cfont.x_size/8)),x+cfont.x_size-1,y+(j/(cfont.x_size/8)));
-				for (int zz=(cfont.x_size/8)-1; zz>=0; zz--)
-				{
-					ch=pgm_read_byte(&cfont.font[temp+zz]);
-					for(i=0;i<8;i++)
-					{   
-						if((ch&(1<<i))!=0)   
-						{
-							setPixel((fch<<8)|fcl);
-						} 
-						else
-						{
-							setPixel((bch<<8)|bcl);
-						}   
-					}
-				}
-				temp+=(cfont.x_size/8);
+				byte	mask=0x80>>(col & 7);
+				word	pos=temp+(col>>3);
+
+				for (byte row=0; row<ys; row++, pos+=bw)
+					_glyph_bits((pgm_read_byte(&cfont.font[pos]) & mask) ? 0x80 : 0x00, 1, fg, bg);
 			}
 		}
+		_stat_data(long(xs)*ys);
 	}
 	else
+		_glyph_runs(temp, x, y, 0);
+
+	sbi(P_CS, B_CS);
+	_auto_clrXY();
+}
+
+// Sends the top n bits of a glyph byte as fg/bg pixels, MSB first.
+// RS has to be set already and the data is not counted.
+void UTFT::_glyph_bits(byte bits, byte n, word fg, word bg)
+{
+	for (; n>0; n--, bits<<=1)
+	{
+		word	col=(bits & 0x80) ? fg : bg;
+
+		if (band.buf!=NULL)
+			_band_fill(col>>8, col & 0xFF, 1);
+		else if (display_transfer_mode!=1)
+			LCD_Writ_Bus(col>>8,col & 0xFF,display_transfer_mode);
+		else
+		{
+			LCD_Writ_Bus(0x01,col>>8,display_transfer_mode);
+			LCD_Writ_Bus(0x01,col & 0xFF,display_transfer_mode);
+		}
+	}
+}
+
+// Offset of source pixel u,v after a rotation by quarter*90 degrees
+static void _rot_point(byte quarter, int u, int v, int *dx, int *dy)
+{
+	switch (quarter)
+	{
+	case 0:	*dx=u;	*dy=v;	break;
+	case 1:	*dx=-v;	*dy=u;	break;
+	case 2:	*dx=-u;	*dy=-v;	break;
+	case 3:	*dx=v;	*dy=-u;	break;
+	}
+}
+
+// Draws the glyph at temp as runs of equal pixels along its rows, rotated
+// by quarter*90 degrees around x,y. Transparent text only gets the runs of
+// set bits. Every run is clipped and gets a window of its own, which makes
+// this the path for transparent and for partly visible glyphs. CS must be
+// low.
+void UTFT::_glyph_runs(word temp, int x, int y, byte quarter)
+{
+	byte	bw=cfont.x_size/8;
+	byte	xs=cfont.x_size, ys=cfont.y_size;
+
+	for (byte row=0; row<ys; row++, temp+=bw)
 	{
-		temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-		for(j=0;j<cfont.y_size;j++) 
+		int		start=0;
+		boolean	prev=(pgm_read_byte(&cfont.font[temp]) & 0x80)!=0;
+
+		for (int col=1; col<=xs; col++)
 		{
-			for (int zz=0; zz<(cfont.x_size/8); zz++)
+			boolean	set=(col<xs) and (pgm_read_byte(&cfont.font[temp+(col>>3)]) & (0x80>>(col & 7)));
+
+			if ((col<xs) and (set==prev))
+				continue;
+			if (prev or !_transparent)
 			{
-				ch=pgm_read_byte(&cfont.font[temp+zz]); 
-				for(i=0;i<8;i++)
-				{   
-					setXY(x+i+(zz*8),y+j,x+i+(zz*8)+1,y+j+1);
-				
-					if((ch&(1<<(7-i)))!=0)   
-					{
-						setPixel((fch<<8)|fcl);
-					} 
+				int		ax, ay, bx, by;
+				int		x1, y1, x2, y2;
+
+				_rot_point(quarter, start, row, &ax, &ay);
+				_rot_point(quarter, col-1, row, &bx, &by);
+				x1=x+min(ax, bx);
+				y1=y+min(ay, by);
+				x2=x+max(ax, bx);
+				y2=y+max(ay, by);
+				if (_clip_rect(&x1, &y1, &x2, &y2))
+				{
+					setXY(x1, y1, x2, y2);
+					if (prev)
+						_push_run(fch, fcl, long(x2-x1+1)*(y2-y1+1));
+					else
+						_push_run(bch, bcl, long(x2-x1+1)*(y2-y1+1));
 				}
 			}
-			temp+=(cfont.x_size/8);
+			start=col;
+			prev=set;
 		}
 	}
+}
 
-	sbi(P_CS, B_CS);
-	clrXY();
+// Rotations by multiples of 90 degrees map a sx*sy source at x,y onto a
+// window. The window is set and scan walks the source in the order the
+// controller fills it, so the pixels can be sent without further setXY().
+void UTFT::_rot_setup(_rot_scan *scan, int x, int y, int sx, int sy, byte quarter)
+{
+	int		ax, ay, bx, by;
+	int		x1, y1, x2, y2;
+
+	_rot_point(quarter, 0, 0, &ax, &ay);
+	_rot_point(quarter, sx-1, sy-1, &bx, &by);
+	x1=x+min(ax, bx);
+	y1=y+min(ay, by);
+	x2=x+max(ax, bx);
+	y2=y+max(ay, by);
+	setXY(x1, y1, x2, y2);
+
+	// The inverse rotation is the rotation by the remaining quarters
+	quarter=(4-quarter) & 3;
+	if (orient==PORTRAIT)
+	{
+		_rot_point(quarter, x1-x, y1-y, &scan->u, &scan->v);
+		_rot_point(quarter, 1, 0, &scan->du, &scan->dv);
+		_rot_point(quarter, 0, 1, &scan->lu, &scan->lv);
+		scan->len=x2-x1+1;
+		scan->lines=y2-y1+1;
+	}
+	else
+	{
+		_rot_point(quarter, x2-x, y1-y, &scan->u, &scan->v);
+		_rot_point(quarter, 0, 1, &scan->du, &scan->dv);
+		_rot_point(quarter, -1, 0, &scan->lu, &scan->lv);
+		scan->len=y2-y1+1;
+		scan->lines=x2-x1+1;
+	}
 }
 
+// The glyph is rotated around x,y, pos is the index of the character in
+// the string. Multiples of 90 degrees fill one window, transparent text
+// and partly clipped glyphs are drawn as runs. Other angles step through
+// the glyph in fixed point and set every pixel on its own.
 void UTFT::rotateChar(byte c, int x, int y, int pos, int deg)
 {
-	byte i,j,ch;
-	word temp; 
-	int newx,newy;
-	double radian;
-	radian=deg*0.0175;  
+	byte	bw=cfont.x_size/8;
+	byte	xs=cfont.x_size, ys=cfont.y_size;
+	word	temp=((c-cfont.offset)*(bw*ys))+4;
+	word	fg=(fch<<8)|fcl;
+	word	bg=(bch<<8)|bcl;
+
+	deg=((deg % 360) + 360) % 360;
 
 	cbi(P_CS, B_CS);
 
-	temp=((c-cfont.offset)*((cfont.x_size/8)*cfont.y_size))+4;
-	for(j=0;j<cfont.y_size;j++) 
+	if ((deg % 90)==0)
 	{
-		for (int zz=0; zz<(cfont.x_size/8); zz++)
+		byte	quarter=deg/90;
+		int		ox, oy, ax, ay;
+
+		_rot_point(quarter, pos*xs, 0, &ox, &oy);
+		ox+=x;
+		oy+=y;
+		_rot_point(quarter, xs-1, ys-1, &ax, &ay);
+		if ((!_transparent) and ((_clip_code(ox, oy) | _clip_code(ox+ax, oy+ay))==0))
 		{
-			ch=pgm_read_byte(&cfont.font[temp+zz]); 
-			for(i=0;i<8;i++)
-			{   
-				newx=x+(((i+(zz*8)+(pos*cfont.x_size))*cos(radian))-((j)*sin(radian)));
-				newy=y+(((j)*cos(radian))+((i+(zz*8)+(pos*cfont.x_size))*sin(radian)));
-
-				setXY(newx,newy,newx+1,newy+1);
-				
-				if((ch&(1<<(7-i)))!=0)   
+			_rot_scan	scan;
+
+			_rot_setup(&scan, ox, oy, xs, ys, quarter);
+			if (display_transfer_mode!=1)
+				sbi(P_RS, B_RS);
+			for (int l=0; l<scan.lines; l++)
+			{
+				int		u=scan.u, v=scan.v;
+
+				for (int k=0; k<scan.len; k++)
+				{
+					byte	bits=pgm_read_byte(&cfont.font[temp+(v*bw)+(u>>3)]) & (0x80>>(u & 7));
+
+					_glyph_bits(bits ? 0x80 : 0x00, 1, fg, bg);
+					u+=scan.du;
+					v+=scan.dv;
+				}
+				scan.u+=scan.lu;
+				scan.v+=scan.lv;
+			}
+			_stat_data(long(xs)*ys);
+		}
+		else
+			_glyph_runs(temp, ox, oy, quarter);
+	}
+	else
+	{
+		long	cs=_icos(deg), sn=_isin(deg);
+		long	u0=long(pos)*xs;
+
+		for (byte row=0; row<ys; row++, temp+=bw)
+		{
+			long	fx=u0*cs - row*sn + SIN_ONE/2;
+			long	fy=row*cs + u0*sn + SIN_ONE/2;
+
+			for (byte col=0; col<xs; col++, fx+=cs, fy+=sn)
+			{
+				int		nx=x+int(fx>>SIN_SHIFT);
+				int		ny=y+int(fy>>SIN_SHIFT);
+
+				if (_clip_code(nx, ny)!=0)
+					continue;
+				if (pgm_read_byte(&cfont.font[temp+(col>>3)]) & (0x80>>(col & 7)))
 				{
-					setPixel((fch<<8)|fcl);
-				} 
-				else  
+					setXY(nx, ny, nx, ny);
+					LCD_Write_DATA(fch, fcl);
+				}
+				else if (!_transparent)
 				{
-					if (!_transparent)
-						setPixel((bch<<8)|bcl);
-				}   
+					setXY(nx, ny, nx, ny);
+					LCD_Write_DATA(bch, bcl);
+				}
 			}
 		}
-		temp+=(cfont.x_size/8);
 	}
+
 	sbi(P_CS, B_CS);
-	clrXY();
+	_auto_clrXY();
 }
 
 void UTFT::print(char *st, int x, int y, int deg)
@@ -997,8 +1731,16 @@ void UTFT::print(String st, int x, int y, int deg)
 
 void UTFT::printNumI(long num, int x, int y, int length, char filler)
 {
-	char buf[25];
 	char st[27];
+
+	_format_num_i(st, num, length, filler);
+	print(st,x,y);
+}
+
+// Formats num like printNumI() prints it, st needs 27 chars
+void UTFT::_format_num_i(char *st, long num, int length, char filler)
+{
+	char buf[25];
 	boolean neg=false;
 	int c=0, f=0;
   
@@ -1054,13 +1796,19 @@ void UTFT::printNumI(long num, int x, int y, int length, char filler)
 		st[c+neg+f]=0;
 
 	}
-
-	print(st,x,y);
 }
 
 void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int length, char filler)
 {
 	char st[27];
+
+	_format_num_f(st, num, dec, divider, length, filler);
+	print(st,x,y);
+}
+
+// Formats num like printNumF() prints it, st needs 27 chars
+void UTFT::_format_num_f(char *st, double num, byte dec, char divider, int length, char filler)
+{
 	boolean neg=false;
 
 	if (dec<1)
@@ -1075,7 +1823,7 @@ void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int lengt
 
 	if (divider != '.')
 	{
-		for (int i=0; i<sizeof(st); i++)
+		for (int i=0; i<27; i++)
 			if (st[i]=='.')
 				st[i]=divider;
 	}
@@ -1085,19 +1833,17 @@ void UTFT::printNumF(double num, byte dec, int x, int y, char divider, int lengt
 		if (neg)
 		{
 			st[0]='-';
-			for (int i=1; i<sizeof(st); i++)
+			for (int i=1; i<27; i++)
 				if ((st[i]==' ') || (st[i]=='-'))
 					st[i]=filler;
 		}
 		else
 		{
-			for (int i=0; i<sizeof(st); i++)
+			for (int i=0; i<27; i++)
 				if (st[i]==' ')
 					st[i]=filler;
 		}
 	}
-
-	print(st,x,y);
 }
 
 void UTFT::setFont(uint8_t* font)
@@ -1127,35 +1873,33 @@ uint8_t UTFT::getFontYsize()
 void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale)
 {
 	unsigned int col;
-	int tx, ty, tc, tsx, tsy;
+	int tx, ty, tsx, tsy;
 
 	if (scale==1)
 	{
-		if (orient==PORTRAIT)
-		{
-			cbi(P_CS, B_CS);
-			setXY(x, y, x+sx-1, y+sy-1);
-			for (tc=0; tc<(sx*sy); tc++)
-			{
-				col=pgm_read_word(&data[tc]);
-				LCD_Write_DATA(col>>8,col & 0xff);
-			}
-			sbi(P_CS, B_CS);
-		}
-		else
-		{
-			cbi(P_CS, B_CS);
-			for (ty=0; ty<sy; ty++)
+		// One window in portrait, a window per row written backwards in
+		// landscape, clipped pieces of rows if partly visible
+		_begin_write(x, y, x+sx-1, y+sy-1, PORTRAIT);
+		_push_pixels((const uint16_t *)data, true, long(sx)*sy);
+		sbi(P_CS, B_CS);
+	}
+	else if ((_clip_code(x, y) | _clip_code(x+sx*scale-1, y+sy*scale-1))!=0)
+	{
+		// Partly visible, a clipped window for every scaled pixel
+		cbi(P_CS, B_CS);
+		for (ty=0; ty<sy; ty++)
+			for (tx=0; tx<sx; tx++)
 			{
-				setXY(x, y+ty, x+sx-1, y+ty);
-				for (tx=sx-1; tx>=0; tx--)
+				int		x1=x+tx*scale, y1=y+ty*scale, x2=x1+scale-1, y2=y1+scale-1;
+
+				if (_clip_rect(&x1, &y1, &x2, &y2))
 				{
 					col=pgm_read_word(&data[(ty*sx)+tx]);
-					LCD_Write_DATA(col>>8,col & 0xff);
+					setXY(x1, y1, x2, y2);
+					_push_run(col>>8, col & 0xff, long(x2-x1+1)*(y2-y1+1));
 				}
 			}
-			sbi(P_CS, B_CS);
-		}
+		sbi(P_CS, B_CS);
 	}
 	else
 	{
@@ -1194,35 +1938,845 @@ void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int sca
 			sbi(P_CS, B_CS);
 		}
 	}
-	clrXY();
+	_auto_clrXY();
 }
 
+// Rotation around rox,roy of the bitmap, the same way as rotateChar().
+// Partly clipped bitmaps take the pixel by pixel path of other angles.
 void UTFT::drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy)
 {
 	unsigned int col;
-	int tx, ty, newx, newy;
-	double radian;
-	radian=deg*0.0175;  
+	int ox, oy, ax, ay;
+	byte quarter;
+	boolean window=false;
 
 	if (deg==0)
 		drawBitmap(x, y, sx, sy, data);
 	else
 	{
+		deg=((deg % 360) + 360) % 360;
+		quarter=deg/90;
+
+		if ((deg % 90)==0)
+		{
+			_rot_point(quarter, -rox, -roy, &ox, &oy);
+			ox+=x+rox;
+			oy+=y+roy;
+			_rot_point(quarter, sx-1, sy-1, &ax, &ay);
+			window=(_clip_code(ox, oy) | _clip_code(ox+ax, oy+ay))==0;
+		}
+
 		cbi(P_CS, B_CS);
-		for (ty=0; ty<sy; ty++)
-			for (tx=0; tx<sx; tx++)
+		if (window)
+		{
+			_rot_scan	scan;
+
+			_rot_setup(&scan, ox, oy, sx, sy, quarter);
+			for (int l=0; l<scan.lines; l++)
 			{
-				col=pgm_read_word(&data[(ty*sx)+tx]);
+				int		u=scan.u, v=scan.v;
 
-				newx=x+rox+(((tx-rox)*cos(radian))-((ty-roy)*sin(radian)));
-				newy=y+roy+(((ty-roy)*cos(radian))+((tx-rox)*sin(radian)));
+				for (int k=0; k<scan.len; k++)
+				{
+					col=pgm_read_word(&data[(v*sx)+u]);
+					LCD_Write_DATA(col>>8,col & 0xff);
+					u+=scan.du;
+					v+=scan.dv;
+				}
+				scan.u+=scan.lu;
+				scan.v+=scan.lv;
+			}
+		}
+		else
+		{
+			long	cs=_icos(deg), sn=_isin(deg);
+
+			for (int ty=0; ty<sy; ty++)
+			{
+				long	fx=long(-rox)*cs - long(ty-roy)*sn + SIN_ONE/2;
+				long	fy=long(ty-roy)*cs + long(-rox)*sn + SIN_ONE/2;
+
+				for (int tx=0; tx<sx; tx++, fx+=cs, fy+=sn)
+				{
+					int		nx=x+rox+int(fx>>SIN_SHIFT);
+					int		ny=y+roy+int(fy>>SIN_SHIFT);
 
-				setXY(newx, newy, newx, newy);
-				LCD_Write_DATA(col>>8,col & 0xff);
+					if (_clip_code(nx, ny)!=0)
+						continue;
+					col=pgm_read_word(&data[(ty*sx)+tx]);
+					setXY(nx, ny, nx, ny);
+					LCD_Write_DATA(col>>8,col & 0xff);
+				}
 			}
+		}
 		sbi(P_CS, B_CS);
 	}
-	clrXY();
+	_auto_clrXY();
+}
+
+// Packed bitmaps as written by Tools/bitmap_converter.py:
+//   byte 0     bits per pixel (1, 2, 4, 8 or 16) | BITMAP_COLUMNS | BITMAP_RLE
+//   byte 1-4   width and height, LSB first
+//   byte 5     number of palette entries - 1, not present for 16 bpp
+//   ...        palette, RGB565 MSB first
+//   ...        pixels
+// Pixels are palette indices packed MSB first, or RGB565 MSB first for
+// 16 bpp. With BITMAP_RLE they come in packets: a control byte c, then
+// (c & 0x7F)+1 copies of one value if bit 7 is set, else c+1 values. Every
+// packet starts on a byte boundary. Without BITMAP_COLUMNS the pixels are
+// in reading order. With it they are in the order a landscape window is
+// filled: columns from right to left, each from top to bottom.
+
+// Reads the next pixel of a packed bitmap and returns it as RGB565
+static word _bitmap_read(const uint8_t **data, byte *bit, byte bpp, const uint8_t *pal)
+{
+	byte	idx;
+
+	if (bpp==16)
+	{
+		word	col=(pgm_read_byte(*data)<<8) | pgm_read_byte(*data+1);
+		*data+=2;
+		return col;
+	}
+	idx=(pgm_read_byte(*data)>>(8-bpp-*bit)) & ((1<<bpp)-1);
+	*bit+=bpp;
+	if (*bit==8)
+	{
+		*bit=0;
+		(*data)++;
+	}
+	return (pgm_read_byte(&pal[idx*2])<<8) | pgm_read_byte(&pal[idx*2+1]);
+}
+
+void UTFT::drawPackedBitmap(int x, int y, const uint8_t *data)
+{
+	byte			format=pgm_read_byte(&data[0]);
+	byte			bpp=format & BITMAP_BPP;
+	byte			order=(format & BITMAP_COLUMNS) ? LANDSCAPE : PORTRAIT;
+	int				sx=pgm_read_byte(&data[1]) | (pgm_read_byte(&data[2])<<8);
+	int				sy=pgm_read_byte(&data[3]) | (pgm_read_byte(&data[4])<<8);
+	const uint8_t	*pal=0;
+	long			left=long(sx)*sy;
+	byte			bit=0;
+	int				line=(order==PORTRAIT) ? sx : sy;
+	int				pos=0;
+	word			buf[64];
+	byte			fill=0;
+
+	data+=5;
+	if (bpp!=16)
+	{
+		pal=data+1;
+		data+=1+2*(pgm_read_byte(data)+1);
+	}
+
+	// With one window for the whole bitmap runs are sent as fills. With a
+	// window per line they go through the buffer as well, which is flushed
+	// when full and at the end of every line, so that short runs and
+	// literals do not get a window of their own.
+	_begin_write(x, y, x+sx-1, y+sy-1, order);
+	while (left>0)
+	{
+		long	n=left;
+		boolean	run=false;
+		word	col=0;
+
+		if (format & BITMAP_RLE)
+		{
+			byte	c=pgm_read_byte(data++);
+
+			n=min(long((c & 0x7F)+1), left);
+			run=(c & 0x80)!=0;
+			if (run)
+				col=_bitmap_read(&data, &bit, bpp, pal);
+		}
+		left-=n;
+		if (run and (orient==order))
+		{
+			_push_pixels(buf, false, fill);
+			fill=0;
+			pushColor(col, n);
+		}
+		else
+			for (; n>0; n--)
+			{
+				buf[fill++]=run ? col : _bitmap_read(&data, &bit, bpp, pal);
+				if (++pos==line)
+					pos=0;
+				if ((fill==64) or (pos==0))
+				{
+					_push_pixels(buf, false, fill);
+					fill=0;
+				}
+			}
+		if (bit!=0)
+		{
+			bit=0;
+			data++;
+		}
+	}
+	_push_pixels(buf, false, fill);
+	endWrite();
+}
+
+// Streaming writes: beginWrite() selects the display and sets the window,
+// the push functions then fill it in normal reading order (left to right,
+// top to bottom) and endWrite() releases the display again. No other
+// drawing function may be called in between. With order LANDSCAPE the
+// window is filled by columns instead, from right to left and each one top
+// to bottom; that is one window on a display in landscape orientation.
+void UTFT::beginWrite(int x1, int y1, int x2, int y2, byte order)
+{
+	_begin_write(x1, y1, x2, y2, order);
+}
+
+void UTFT::pushPixels(const uint16_t *data, long count)
+{
+	_push_pixels(data, false, count);
+}
+
+void UTFT::pushPixels_P(const uint16_t *data, long count)
+{
+	_push_pixels(data, true, count);
+}
+
+void UTFT::pushColor(word color, long count)
+{
+	while (count>0)
+	{
+		boolean	visible;
+		long	n=_push_segment(count, &visible);
+
+		if (visible)
+			_push_run(byte(color>>8), byte(color & 0xFF), n);
+		count-=n;
+	}
+}
+
+void UTFT::endWrite()
+{
+	sbi(P_CS, B_CS);
+	_auto_clrXY();
+}
+
+// order is the orientation whose window fill order the pixels follow:
+// PORTRAIT for reading order, LANDSCAPE for columns from right to left.
+void UTFT::_begin_write(int x1, int y1, int x2, int y2, byte order)
+{
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+
+	wr_x1=x1;
+	wr_y1=y1;
+	wr_x2=x2;
+	wr_y2=y2;
+	wr_x=(order==PORTRAIT) ? x1 : x2;
+	wr_y=y1;
+	wr_order=order;
+	if ((_clip_code(x1, y1) | _clip_code(x2, y2))==0)
+		wr_clip=WR_INSIDE;
+	else if ((x1>clip.x2) or (x2<clip.x1) or (y1>clip.y2) or (y2<clip.y1))
+		wr_clip=WR_OUTSIDE;
+	else
+		wr_clip=WR_PARTIAL;
+
+	cbi(P_CS, B_CS);
+	if ((orient==order) and (wr_clip==WR_INSIDE))
+		setXY(x1, y1, x2, y2);
+}
+
+// If the pixel order matches the orientation one window takes them all.
+// Otherwise reading order gets a window per row, written backwards like
+// drawBitmap() does in landscape, and column order a window per column.
+// Partly clipped writes always go by rows or columns, which are split at
+// the clip edges. Returns how many of count pixels go into the current
+// window, visible is false if they are clipped and have to be skipped.
+long UTFT::_push_segment(long count, boolean *visible)
+{
+	long	n;
+	int		a, b;
+
+	*visible=(wr_clip!=WR_OUTSIDE);
+	if ((wr_clip==WR_OUTSIDE) or ((orient==wr_order) and (wr_clip==WR_INSIDE)))
+		return count;
+
+	if (wr_order==PORTRAIT)
+	{
+		a=wr_x;
+		b=wr_x2;
+		if ((wr_y<clip.y1) or (wr_y>clip.y2) or (a>clip.x2))
+			*visible=false;
+		else if (a<clip.x1)
+		{
+			b=min(b, clip.x1-1);
+			*visible=false;
+		}
+		else
+			b=min(b, clip.x2);
+		n=min(count, long(b-a+1));
+		if (*visible)
+			setXY(wr_x, wr_y, wr_x+n-1, wr_y);
+		wr_x+=n;
+		if (wr_x>wr_x2)
+		{
+			wr_x=wr_x1;
+			if (++wr_y>wr_y2)
+				wr_y=wr_y1;
+		}
+	}
+	else
+	{
+		a=wr_y;
+		b=wr_y2;
+		if ((wr_x<clip.x1) or (wr_x>clip.x2) or (a>clip.y2))
+			*visible=false;
+		else if (a<clip.y1)
+		{
+			b=min(b, clip.y1-1);
+			*visible=false;
+		}
+		else
+			b=min(b, clip.y2);
+		n=min(count, long(b-a+1));
+		if (*visible)
+			setXY(wr_x, wr_y, wr_x, wr_y+n-1);
+		wr_y+=n;
+		if (wr_y>wr_y2)
+		{
+			wr_y=wr_y1;
+			if (--wr_x<wr_x1)
+				wr_x=wr_x2;
+		}
+	}
+	return n;
+}
+
+void UTFT::_push_pixels(const uint16_t *data, boolean progmem, long count)
+{
+	word	col;
+
+	while (count>0)
+	{
+		boolean	visible;
+		long	n=_push_segment(count, &visible);
+
+		for (long i=0; visible and (i<n); i++)
+		{
+			long	j=((orient==LANDSCAPE) and (wr_order==PORTRAIT)) ? n-1-i : i;
+
+			if (progmem)
+				col=pgm_read_word(&data[j]);
+			else
+				col=data[j];
+			LCD_Write_DATA(col>>8, col & 0xff);
+		}
+		data+=n;
+		count-=n;
+	}
+}
+
+// Writes exactly pix pixels. _fast_fill_16() and _fast_fill_8() are only
+// exact for multiples of 16, the rest is written one by one.
+// _fast_fill_8x2() and _fast_fill_serial() are exact.
+void UTFT::_push_run(byte ch, byte cl, long pix)
+{
+	long	blocks=pix & ~15L;
+
+	if (band.buf!=NULL)
+	{
+		_band_fill(ch, cl, pix);
+		pix=0;
+	}
+	else if ((blocks>0) and (display_transfer_mode==16))
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_16(ch, cl, blocks);
+		_stat_data(blocks);
+		pix-=blocks;
+	}
+	else if ((blocks>0) and (display_transfer_mode==8) and (ch==cl))
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_8(ch, blocks);
+		_stat_data(blocks);
+		pix-=blocks;
+	}
+	else if (display_transfer_mode==8)
+	{
+		sbi(P_RS, B_RS);
+		_fast_fill_8x2(ch, cl, pix);
+		_stat_data(pix);
+		pix=0;
+	}
+	else if (display_transfer_mode==1)
+	{
+		_fast_fill_serial(ch, cl, pix);
+		_stat_data(pix);
+		pix=0;
+	}
+	for (long i=0; i<pix; i++)
+		LCD_Write_DATA(ch, cl);
+}
+
+// Off-screen band
+// ---------------
+// Between beginBand() and endBand() all drawing functions draw into buffer
+// instead of the display. The buffer holds the RGB565 pixels of the band
+// x1,y1-x2,y2, so it needs (x2-x1+1)*(y2-y1+1) words, e.g. 2 KB for a
+// 32x32 tile. It can be anywhere in RAM, including external memory on the
+// ATmega2560. Pixels outside of the band are dropped and the band is not
+// cleared, so the first thing to draw is normally its background.
+// endBand() sends the whole band in one window. Overlapping elements cost
+// the bus one write per pixel and are never visible half drawn.
+// endBand(false) keeps the pixels in the buffer without sending them, so a
+// region can be rendered in advance and sent later by calling beginBand()
+// and endBand() again with the same buffer.
+void UTFT::beginBand(int x1, int y1, int x2, int y2, word *buffer)
+{
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+
+	// setXY() stores the window in band.wx1.. while a band is active, which
+	// converts the band to controller coordinates. A display list recorded
+	// before goes to the display, not into the band.
+	_dl_flush();
+	band.buf=buffer;
+	setXY(x1, y1, x2, y2);
+	band.x1=band.wx1;
+	band.y1=band.wy1;
+	band.x2=band.wx2;
+	band.y2=band.wy2;
+}
+
+void UTFT::endBand(boolean flush)
+{
+	word	*p=band.buf;
+	long	count=long(band.x2-band.x1+1)*(band.y2-band.y1+1);
+
+	if (p==NULL)
+		return;
+	_dl_flush();
+	band.buf=NULL;
+	if (!flush)
+		return;
+
+	cbi(P_CS, B_CS);
+	if (orient==PORTRAIT)
+		setXY(band.x1, band.y1, band.x2, band.y2);
+	else
+		setXY(disp_y_size-band.y2, band.x1, disp_y_size-band.y1, band.x2);
+	if (display_transfer_mode!=1)
+		sbi(P_RS, B_RS);
+	for (long i=0; i<count; i++, p++)
+	{
+		if (display_transfer_mode!=1)
+			LCD_Writ_Bus(*p>>8, *p & 0xFF, display_transfer_mode);
+		else
+		{
+			LCD_Writ_Bus(0x01, *p>>8, display_transfer_mode);
+			LCD_Writ_Bus(0x01, *p & 0xFF, display_transfer_mode);
+		}
+	}
+	_stat_data(count);
+	sbi(P_CS, B_CS);
+	_auto_clrXY();
+}
+
+// Writes pix pixels into the band like the controller writes them into
+// its window: row by row in controller coordinates, wrapping around at
+// the end of the window
+void UTFT::_band_fill(byte ch, byte cl, long pix)
+{
+	word	col=(ch<<8) | cl;
+	int		w=band.x2-band.x1+1;
+
+	if ((band.wx1>band.wx2) or (band.wy1>band.wy2))
+		return;
+
+	while (pix>0)
+	{
+		long	n=min(pix, long(band.wx2-band.wx+1));
+
+		if ((band.wy>=band.y1) and (band.wy<=band.y2))
+		{
+			int		a=max(band.wx, band.x1);
+			int		b=min(long(band.wx)+n-1, long(band.x2));
+			word	*p=&band.buf[long(band.wy-band.y1)*w+(a-band.x1)];
+
+			for (; a<=b; a++)
+				*p++=col;
+		}
+		pix-=n;
+		band.wx+=n;
+		if (band.wx>band.wx2)
+		{
+			band.wx=band.wx1;
+			if (++band.wy>band.wy2)
+				band.wy=band.wy1;
+		}
+	}
+}
+
+// Display list
+// ------------
+// Between beginList() and endList() rectangles (fillRect(), drawRect(),
+// H/V lines and pixels) and lines are recorded into buffer instead of being
+// drawn. Before the list is sent, ops that a later rectangle covers are
+// dropped and rectangles of the same color that line up are merged, as long
+// as no op in between overlaps them. All other drawing sends the list first,
+// so the image is always the same as without the list. A full buffer is
+// sent as well. A rectangle takes 11 bytes, a line 19 bytes on AVR.
+// dlist.recorded and dlist.replayed count the ops before and after.
+void UTFT::beginList(byte *buffer, int size)
+{
+	dlist.buf=buffer;
+	dlist.size=size;
+	dlist.len=0;
+}
+
+void UTFT::endList()
+{
+	_dl_flush();
+	dlist.buf=NULL;
+}
+
+// Records op with the coordinates v and the current color, false if it
+// does not fit into the list at all
+boolean UTFT::_dl_add(byte op, const int *v)
+{
+	byte	n=(op==DL_LINE) ? 8 : 4;
+	int		len=1+n*sizeof(int)+sizeof(word);
+	word	color=(fch<<8)|fcl;
+
+	if (len>dlist.size)
+		return false;
+	if (dlist.len+len>dlist.size)
+		_dl_flush();
+
+	byte	*p=&dlist.buf[dlist.len];
+
+	*p=op;
+	memcpy(p+1, v, n*sizeof(int));
+	memcpy(p+1+n*sizeof(int), &color, sizeof(word));
+	dlist.len+=len;
+	dlist.recorded++;
+	return true;
+}
+
+// Reads the op at pos, returns the position of the next one
+int UTFT::_dl_read(const byte *buf, int pos, byte *op, int *v, word *color)
+{
+	byte	n;
+
+	*op=buf[pos];
+	n=((*op & ~DL_DROPPED)==DL_LINE) ? 8 : 4;
+	memcpy(v, &buf[pos+1], n*sizeof(int));
+	memcpy(color, &buf[pos+1+n*sizeof(int)], sizeof(word));
+	return pos+1+n*sizeof(int)+sizeof(word);
+}
+
+// Area an op can draw to, empty (x1>x2) for a line outside of its clip
+void UTFT::_dl_bounds(byte op, const int *v, _clip_area *r)
+{
+	r->x1=min(v[0], v[2]);
+	r->y1=min(v[1], v[3]);
+	r->x2=max(v[0], v[2]);
+	r->y2=max(v[1], v[3]);
+	if ((op & ~DL_DROPPED)==DL_LINE)
+	{
+		r->x1=max(r->x1, v[4]);
+		r->y1=max(r->y1, v[5]);
+		r->x2=min(r->x2, v[6]);
+		r->y2=min(r->y2, v[7]);
+	}
+}
+
+// true if an op that is not dropped between from and to overlaps r
+boolean UTFT::_dl_overlap(const byte *buf, int from, int to, const _clip_area *r)
+{
+	byte		op;
+	int			v[8];
+	word		color;
+	_clip_area	b;
+
+	while (from<to)
+	{
+		from=_dl_read(buf, from, &op, v, &color);
+		_dl_bounds(op, v, &b);
+		if (!(op & DL_DROPPED) and (b.x1<=r->x2) and (b.x2>=r->x1) and (b.y1<=r->y2) and (b.y2>=r->y1))
+			return true;
+	}
+	return false;
+}
+
+void UTFT::_dl_optimize(byte *buf, int len)
+{
+	byte		op, opj;
+	int			v[8], w[8];
+	word		color, colorj;
+	_clip_area	a, b;
+	int			i, j, next, nextj;
+
+	// Drop ops that a later rectangle covers
+	for (i=0; i<len; i=next)
+	{
+		next=_dl_read(buf, i, &op, v, &color);
+		_dl_bounds(op, v, &a);
+		for (j=next; j<len; j=nextj)
+		{
+			nextj=_dl_read(buf, j, &opj, w, &colorj);
+			if ((opj==DL_RECT) and (w[0]<=a.x1) and (w[1]<=a.y1) and (w[2]>=a.x2) and (w[3]>=a.y2))
+			{
+				buf[i]|=DL_DROPPED;
+				break;
+			}
+		}
+	}
+
+	// Merge rectangles of the same color into the later one if nothing in
+	// between overlaps the earlier one, else into the earlier one if nothing
+	// overlaps the later one
+	for (i=0; i<len; i=next)
+	{
+		next=_dl_read(buf, i, &op, v, &color);
+		for (j=next; (op==DL_RECT) and (j<len); j=nextj)
+		{
+			nextj=_dl_read(buf, j, &opj, w, &colorj);
+			if ((opj!=DL_RECT) or (colorj!=color))
+				continue;
+			if (!(((v[0]==w[0]) and (v[2]==w[2]) and (w[1]<=v[3]+1) and (w[3]>=v[1]-1)) or
+				  ((v[1]==w[1]) and (v[3]==w[3]) and (w[0]<=v[2]+1) and (w[2]>=v[0]-1))))
+				continue;
+
+			_dl_bounds(op, v, &a);
+			_dl_bounds(opj, w, &b);
+			w[0]=min(v[0], w[0]);
+			w[1]=min(v[1], w[1]);
+			w[2]=max(v[2], w[2]);
+			w[3]=max(v[3], w[3]);
+			if (!_dl_overlap(buf, next, j, &a))
+			{
+				memcpy(&buf[j+1], w, 4*sizeof(int));
+				buf[i]|=DL_DROPPED;
+				break;
+			}
+			if (!_dl_overlap(buf, next, j, &b))
+			{
+				memcpy(&buf[i+1], w, 4*sizeof(int));
+				memcpy(v, w, 4*sizeof(int));
+				buf[j]|=DL_DROPPED;
+				nextj=next;
+			}
+		}
+	}
+}
+
+// Optimizes and sends the list, which is empty afterwards. The rectangles
+// were clipped when they were recorded, the lines get their own clip back.
+void UTFT::_dl_flush()
+{
+	byte		*buf=dlist.buf;
+	int			len=dlist.len;
+	byte		op;
+	int			v[8];
+	word		color, fc=(fch<<8)|fcl;
+	_clip_area	c=clip, screen;
+
+	if ((buf==NULL) or (len==0))
+		return;
+	dlist.buf=NULL;
+	dlist.len=0;
+
+	screen.x1=0;
+	screen.y1=0;
+	screen.x2=getDisplayXSize()-1;
+	screen.y2=getDisplayYSize()-1;
+	clip=screen;
+
+	_dl_optimize(buf, len);
+	for (int pos=0; pos<len; )
+	{
+		pos=_dl_read(buf, pos, &op, v, &color);
+		if (op & DL_DROPPED)
+			continue;
+		setColor(color);
+		if (op==DL_RECT)
+			fillRect(v[0], v[1], v[2], v[3]);
+		else
+		{
+			clip.x1=v[4];
+			clip.y1=v[5];
+			clip.x2=v[6];
+			clip.y2=v[7];
+			drawLine(v[0], v[1], v[2], v[3]);
+			clip=screen;
+		}
+		dlist.replayed++;
+	}
+
+	clip=c;
+	setColor(fc);
+	dlist.buf=buf;
+}
+
+// Clipping
+// --------
+// All drawing functions except clrScr() and fillScr() only draw inside the
+// clip rectangle, which is the whole screen after InitLCD(). pushClip()
+// narrows it to its intersection with x1,y1-x2,y2 and popClip() restores
+// the previous one. Up to UTFT_CLIP_DEPTH levels can be restored, deeper
+// levels keep the narrowest clip until popClip() gets back to a stored one.
+// Primitives that are clipped completely do not touch the bus at all.
+void UTFT::pushClip(int x1, int y1, int x2, int y2)
+{
+	if (x1>x2)
+	{
+		swap(int, x1, x2);
+	}
+	if (y1>y2)
+	{
+		swap(int, y1, y2);
+	}
+
+	if (clip_depth<UTFT_CLIP_DEPTH)
+		clip_stack[clip_depth]=clip;
+	clip_depth++;
+
+	// An empty intersection leaves x1>x2, which clips everything
+	clip.x1=max(clip.x1, x1);
+	clip.y1=max(clip.y1, y1);
+	clip.x2=min(clip.x2, x2);
+	clip.y2=min(clip.y2, y2);
+}
+
+void UTFT::popClip()
+{
+	if (clip_depth==0)
+		return;
+	clip_depth--;
+	if (clip_depth<UTFT_CLIP_DEPTH)
+		clip=clip_stack[clip_depth];
+}
+
+// Cohen-Sutherland outcode of x,y, 0 inside the clip rectangle
+byte UTFT::_clip_code(int x, int y)
+{
+	byte	code=0;
+
+	if (x<clip.x1)
+		code|=CLIP_LEFT;
+	else if (x>clip.x2)
+		code|=CLIP_RIGHT;
+	if (y<clip.y1)
+		code|=CLIP_TOP;
+	else if (y>clip.y2)
+		code|=CLIP_BOTTOM;
+	return code;
+}
+
+// Intersects x1,y1-x2,y2 (x1<=x2, y1<=y2) with the clip rectangle.
+// Returns false if nothing is left.
+boolean UTFT::_clip_rect(int *x1, int *y1, int *x2, int *y2)
+{
+	*x1=max(*x1, clip.x1);
+	*y1=max(*y1, clip.y1);
+	*x2=min(*x2, clip.x2);
+	*y2=min(*y2, clip.y2);
+	return (*x1<=*x2) and (*y1<=*y2);
+}
+
+// Hardware scrolling
+// ------------------
+// The controllers scroll along their long side, these are the rows in
+// PORTRAIT and the columns in LANDSCAPE. setScrollArea() turns the lines
+// first..last into a ring: after scrollTo(offset) the area shows its line
+// first+offset at first, followed by the next lines and wrapping around.
+// Nothing is copied. A strip chart or a log draws one new line where it
+// is going to appear and scrolls by one, instead of repainting the area.
+// The lines outside of the area stay in place. SSD1289 and ILI9325 can
+// only scroll the whole screen, for a smaller area setScrollArea() returns
+// false on those, as it does on controllers without hardware scrolling.
+boolean UTFT::setScrollArea(int first, int last)
+{
+	if (first>last)
+		swap(int, first, last);
+	if ((first<0) or (last>disp_y_size))
+		return false;
+	if (orient==LANDSCAPE)
+	{
+		int		t=first;
+
+		first=disp_y_size-last;
+		last=disp_y_size-t;
+	}
+
+	if (!_set_scroll(first, last, first, true))
+		return false;
+	scroll_first=first;
+	scroll_last=last;
+	return true;
+}
+
+void UTFT::scrollTo(int offset)
+{
+	int		lines=scroll_last-scroll_first+1;
+
+	if (lines<=0)
+		return;
+	offset%=lines;
+	if (offset<0)
+		offset+=lines;
+	// In LANDSCAPE the columns run against the controller lines
+	if ((orient==LANDSCAPE) and (offset!=0))
+		offset=lines-offset;
+	_set_scroll(scroll_first, scroll_last, scroll_first+offset, false);
+}
+
+// first..last are controller lines, vsp is the line shown at first
+boolean UTFT::_set_scroll(int first, int last, int vsp, boolean set_area)
+{
+	boolean	supported=false;
+
+	_dl_flush();
+	cbi(P_CS, B_CS);
+	switch(display_model)
+	{
+#ifndef DISABLE_HX8347A
+	#include "tft_drivers/hx8347a/scroll.h"
+#endif
+#ifndef DISABLE_SSD1289
+	#include "tft_drivers/ssd1289/scroll.h"
+#endif
+#ifndef DISABLE_ILI9325C
+	#include "tft_drivers/ili9325c/scroll.h"
+#endif
+#ifndef DISABLE_ILI9325D
+	#include "tft_drivers/ili9325d/default/scroll.h"
+#endif
+#ifndef DISABLE_ILI9325D_ALT
+	#include "tft_drivers/ili9325d/alt/scroll.h"
+#endif
+#ifndef DISABLE_ILI9341_S4P
+	#include "tft_drivers/ili9341/s4p/scroll.h"
+#endif
+#ifndef DISABLE_ILI9341_S5P
+	#include "tft_drivers/ili9341/s5p/scroll.h"
+#endif
+	}
+	sbi(P_CS, B_CS);
+	return supported;
 }
 
 void UTFT::lcdOff()
@@ -1287,6 +2841,14 @@ int UTFT::getDisplayYSize()
 		return disp_x_size+1;
 }
 
+// The order of beginWrite() that fills a window without clipping as one
+// window. The CPLD modules swap their orientation, so it is not always the
+// one passed to InitLCD().
+byte UTFT::getWriteOrder()
+{
+	return orient;
+}
+
 void UTFT::setBrightness(byte br)
 {
 	cbi(P_CS, B_CS);
@@ -1303,6 +2865,7 @@ void UTFT::setBrightness(byte br)
 
 void UTFT::setDisplayPage(byte page)
 {
+	_dl_flush();
 	cbi(P_CS, B_CS);
 	switch (display_model)
 	{
@@ -1317,6 +2880,7 @@ void UTFT::setDisplayPage(byte page)
 
 void UTFT::setWritePage(byte page)
 {
+	_dl_flush();
 	cbi(P_CS, B_CS);
 	switch (display_model)
 	{
@@ -1328,3 +2892,23 @@ void UTFT::setWritePage(byte page)
 	}
 	sbi(P_CS, B_CS);
 }
+
+// Number of GRAM pages for setDisplayPage() and setWritePage(), 1 if the
+// controller has no paging
+byte UTFT::getPageCount()
+{
+	switch (display_model)
+	{
+	case CPLD:
+		return 8;
+	}
+	return 1;
+}
+
+#if defined(UTFT_BUS_STATS)
+void UTFT::resetBusStats()
+{
+	bus_stats.com=0;
+	bus_stats.data=0;
+}
+#endif
\ No newline at end of file
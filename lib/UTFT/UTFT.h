@@ -147,6 +147,23 @@
 
 #define NOTINUSE		255
 
+// Uncomment the following line to count the commands and data words sent
+// to the display controller (see UTFT::bus_stats). This costs a few cycles
+// per bus write and should only be enabled for measurements.
+//#define UTFT_BUS_STATS 1
+
+// The address window of the controller is cached and only the changed
+// window registers are sent. Primitives no longer reset the window to the
+// full screen when they are done. Uncomment the following line if your
+// code writes to the display without setting a window first and needs the
+// old behaviour.
+//#define UTFT_AUTO_CLRXY 1
+
+// Number of nested pushClip() levels that popClip() can restore
+#ifndef UTFT_CLIP_DEPTH
+	#define UTFT_CLIP_DEPTH 4
+#endif
+
 //*********************************
 // COLORS
 //*********************************
@@ -169,7 +186,13 @@
 #define VGA_PURPLE		0x8010
 #define VGA_TRANSPARENT	0xFFFFFFFF
 
-#if defined(__AVR__)
+// Packs 8 bit r, g and b into the RGB565 word taken by setColor(word)
+#define RGB565(r, g, b)	((word)((((r)&248)<<8)|(((g)&252)<<3)|(((b)&248)>>3)))
+
+#if defined(UTFT_HOST_SIM)
+	#include "Arduino.h"
+	#include "hardware/sim/HW_SIM_defines.h"
+#elif defined(__AVR__)
 	#include "Arduino.h"
 	#include "hardware/avr/HW_AVR_defines.h"
 #elif defined(__PIC32MX__)
@@ -180,6 +203,14 @@
 	#include "hardware/arm/HW_ARM_defines.h"
 #endif
 
+#if defined(UTFT_BUS_STATS)
+struct _bus_stats
+{
+	unsigned long com;
+	unsigned long data;
+};
+#endif
+
 struct _current_font
 {
 	uint8_t* font;
@@ -189,6 +220,42 @@ struct _current_font
 	uint8_t numchars;
 };
 
+struct _arc_sector
+{
+	long sx, sy;	// direction of the start angle
+	long ex, ey;	// direction of the end angle
+	byte mode;
+};
+
+struct _rot_scan
+{
+	int u, v;		// source pixel of the first window pixel
+	int du, dv;		// source step to the next pixel of a line
+	int lu, lv;		// source step to the first pixel of the next line
+	int len, lines;
+};
+
+struct _clip_area
+{
+	int x1, y1, x2, y2;
+};
+
+struct _band
+{
+	word *buf;					// RGB565 pixels in controller order, NULL if no band is active
+	int x1, y1, x2, y2;			// band in controller coordinates
+	int wx1, wy1, wx2, wy2;		// address window set while drawing into the band
+	int wx, wy;					// next pixel of that window
+};
+
+struct _dlist
+{
+	byte *buf;					// recorded ops, NULL if no list is recording
+	int size, len;				// in bytes
+	unsigned long recorded;		// ops recorded since the start
+	unsigned long replayed;		// ops sent to the display after optimizing
+};
+
 class UTFT
 {
 	public:
@@ -206,12 +273,16 @@ class UTFT
 		void	fillRoundRect(int x1, int y1, int x2, int y2);
 		void	drawCircle(int x, int y, int radius);
 		void	fillCircle(int x, int y, int radius);
+		void	drawArc(int x, int y, int radius, int startAngle, int endAngle);
+		void	drawAnnulus(int x, int y, int innerRadius, int outerRadius, int startAngle=0, int endAngle=360);
+		void	fillAnnulus(int x, int y, int innerRadius, int outerRadius, int startAngle=0, int endAngle=360);
 		void	setColor(byte r, byte g, byte b);
 		void	setColor(word color);
 		word	getColor();
 		void	setBackColor(byte r, byte g, byte b);
 		void	setBackColor(uint32_t color);
 		word	getBackColor();
+		void	makeBlendTable(word *table, byte levels, word fg, word bg);
 		void	print(char *st, int x, int y, int deg=0);
 		void	print(String st, int x, int y, int deg=0);
 		void	printNumI(long num, int x, int y, int length=0, char filler=' ');
@@ -222,14 +293,33 @@ class UTFT
 		uint8_t	getFontYsize();
 		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int scale=1);
 		void	drawBitmap(int x, int y, int sx, int sy, bitmapdatatype data, int deg, int rox, int roy);
+		void	drawPackedBitmap(int x, int y, const uint8_t *data);
+		void	beginWrite(int x1, int y1, int x2, int y2, byte order=PORTRAIT);
+		void	pushPixels(const uint16_t *data, long count);
+		void	pushPixels_P(const uint16_t *data, long count);
+		void	pushColor(word color, long count=1);
+		void	endWrite();
+		void	beginBand(int x1, int y1, int x2, int y2, word *buffer);
+		void	endBand(boolean flush=true);
+		void	beginList(byte *buffer, int size);
+		void	endList();
+		void	pushClip(int x1, int y1, int x2, int y2);
+		void	popClip();
+		boolean	setScrollArea(int first, int last);
+		void	scrollTo(int offset);
 		void	lcdOff();
 		void	lcdOn();
 		void	setContrast(char c);
 		int		getDisplayXSize();
 		int		getDisplayYSize();
+		byte	getWriteOrder();
 		void	setBrightness(byte br);
 		void	setDisplayPage(byte page);
 		void	setWritePage(byte page);
+		byte	getPageCount();
+#if defined(UTFT_BUS_STATS)
+		void	resetBusStats();
+#endif
 
 /*
 	The functions and variables below should not normally be used.
@@ -248,6 +338,20 @@ class UTFT
 		byte			__p1, __p2, __p3, __p4, __p5;
 		_current_font	cfont;
 		boolean			_transparent;
+		word			win_x1, win_y1, win_x2, win_y2;
+		boolean			win_valid;
+		int				wr_x1, wr_y1, wr_x2, wr_y2, wr_x, wr_y;
+		byte			wr_order;
+		_band			band;
+		_dlist			dlist;
+		_clip_area		clip;
+		_clip_area		clip_stack[UTFT_CLIP_DEPTH];
+		byte			clip_depth;
+		byte			wr_clip;
+		int				scroll_first, scroll_last;
+#if defined(UTFT_BUS_STATS)
+		_bus_stats		bus_stats;
+#endif
 
 		void LCD_Writ_Bus(char VH,char VL, byte mode);
 		void LCD_Write_COM(char VL);
@@ -259,13 +363,42 @@ class UTFT
 		void drawHLine(int x, int y, int l);
 		void drawVLine(int x, int y, int l);
 		void printChar(byte c, int x, int y);
+		void _glyph_bits(byte bits, byte n, word fg, word bg);
+		void _glyph_runs(word temp, int x, int y, byte quarter);
 		void setXY(word x1, word y1, word x2, word y2);
 		void clrXY();
+		void invalidateXY();
 		void rotateChar(byte c, int x, int y, int pos, int deg);
 		void _set_direction_registers(byte mode);
 		void _fast_fill_16(int ch, int cl, long pix);
 		void _fast_fill_8(int ch, long pix);
+		void _fast_fill_8x2(int ch, int cl, long pix);
+		void _fast_fill_serial(byte ch, byte cl, long pix);
+		void _fast_fill(long pix);
+		void _draw_line_pixels(int x1, int y1, int x2, int y2);
+		void _arc_setup(_arc_sector *sector, int startAngle, int endAngle);
+		void _arc_span(_arc_sector *sector, int x, int y, boolean vertical, int t, int u1, int u2);
+		void _circle_outline(int x, int y, int radius, _arc_sector *sector);
+		void _annulus_fill(int x, int y, int innerRadius, int outerRadius, _arc_sector *sector);
+		void _rot_setup(_rot_scan *scan, int x, int y, int sx, int sy, byte quarter);
+		void _begin_write(int x1, int y1, int x2, int y2, byte order);
+		long _push_segment(long count, boolean *visible);
+		void _push_pixels(const uint16_t *data, boolean progmem, long count);
+		void _push_run(byte ch, byte cl, long pix);
+		void _band_fill(byte ch, byte cl, long pix);
+		boolean _dl_add(byte op, const int *v);
+		int _dl_read(const byte *buf, int pos, byte *op, int *v, word *color);
+		void _dl_bounds(byte op, const int *v, _clip_area *r);
+		boolean _dl_overlap(const byte *buf, int from, int to, const _clip_area *r);
+		void _dl_optimize(byte *buf, int len);
+		void _dl_flush();
+		byte _clip_code(int x, int y);
+		boolean _clip_rect(int *x1, int *y1, int *x2, int *y2);
+		void _line_runs(int u1, int v1, int u2, int v2, boolean steep);
+		boolean _set_scroll(int first, int last, int vsp, boolean set_area);
 		void _convert_float(char *buf, double num, int width, byte prec);
+		void _format_num_i(char *st, long num, int length, char filler);
+		void _format_num_f(char *st, double num, byte dec, char divider, int length, char filler);
 };
 
 #endif
\ No newline at end of file
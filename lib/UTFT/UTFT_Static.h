@@ -0,0 +1,504 @@
+/*
+  UTFT_Static.h - Compile-time configured UTFT for a single display
+  controller on an 8bit or 16bit parallel bus.
+
+  UTFT decides on every bus write which transfer mode is used and on
+  every setXY() which controller is connected. When the display module
+  is known at compile time this is wasted work: UTFT_Static takes the
+  display model as a template parameter, so the transfer mode, display
+  size and controller specific code are constants and the compiler only
+  keeps the code for the selected controller. The init and setXY code is
+  shared with UTFT (tft_drivers/).
+
+  Usage:
+      UTFT_Static<ITDB32S> myGLCD(38,39,40,41);
+
+  Only the drawing primitives are provided (pixels, lines, rectangles
+  and fills). Text and bitmaps are still drawn with UTFT. Unlike UTFT
+  the fills write exactly the number of pixels of the area.
+
+  Supported hardware: Arduino Mega (ATmega1280/2560) and the host
+  simulation (UTFT_HOST_SIM).
+*/
+
+#ifndef UTFT_Static_h
+#define UTFT_Static_h
+
+#include "UTFT.h"
+#include "memorysaver.h"
+
+#if defined(UTFT_HOST_SIM)
+	#include "hardware/sim/HW_SIM_static.h"
+#elif defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__)
+	#include "hardware/avr/HW_ATmega1280_static.h"
+#else
+	#error "UTFT_Static is not available for this MCU, please use UTFT"
+#endif
+
+// Same tables as in UTFT::UTFT()
+static constexpr word	_static_dsx[] = {239, 239, 239, 239, 239, 239, 175, 175, 239, 127, 127, 239, 271, 479, 239, 239, 239, 0, 0, 239, 479, 319, 239, 175, 127, 239, 239, 319, 319, 799, 127, 127};
+static constexpr word	_static_dsy[] = {319, 399, 319, 319, 319, 319, 219, 219, 399, 159, 127, 319, 479, 799, 319, 319, 319, 0, 0, 319, 799, 479, 319, 219, 159, 319, 319, 479, 479, 479, 159, 159};
+static constexpr byte	_static_dtm[] = {16, 16, 16, 8, 8, 16, 8, SERIAL_4PIN, 16, SERIAL_5PIN, SERIAL_5PIN, 16, 16, 16, 8, 16, LATCHED_16, 0, 0, 8, 16, 16, 16, 8, SERIAL_5PIN, SERIAL_5PIN, SERIAL_4PIN, 16, 16, 16, SERIAL_5PIN, SERIAL_5PIN};
+
+template<byte model> class UTFT_Static
+{
+	static_assert(model<sizeof(_static_dtm), "Unknown display model");
+	static_assert((_static_dtm[model]==8) || (_static_dtm[model]==16), "UTFT_Static only supports 8bit and 16bit parallel displays");
+
+	public:
+		static constexpr byte	display_transfer_mode = _static_dtm[model];
+		static constexpr long	disp_x_size = _static_dsx[model];
+		static constexpr long	disp_y_size = _static_dsy[model];
+
+		UTFT_Static(int RS, int WR, int CS, int RST)
+		{
+			__p1 = RS;
+			__p2 = WR;
+			__p3 = CS;
+			__p4 = RST;
+
+			_static_set_direction_registers(display_transfer_mode);
+			P_RS	= portOutputRegister(digitalPinToPort(RS));
+			B_RS	= digitalPinToBitMask(RS);
+			P_WR	= portOutputRegister(digitalPinToPort(WR));
+			B_WR	= digitalPinToBitMask(WR);
+			P_CS	= portOutputRegister(digitalPinToPort(CS));
+			B_CS	= digitalPinToBitMask(CS);
+			P_RST	= portOutputRegister(digitalPinToPort(RST));
+			B_RST	= digitalPinToBitMask(RST);
+		}
+
+		void InitLCD(byte orientation=LANDSCAPE)
+		{
+			orient=orientation;
+#if defined(UTFT_HOST_SIM)
+			UTFTSim::attach(model, disp_x_size, disp_y_size, &orient, P_CS, B_CS);
+#endif
+
+			pinMode(__p1,OUTPUT);
+			pinMode(__p2,OUTPUT);
+			pinMode(__p3,OUTPUT);
+			pinMode(__p4,OUTPUT);
+			_static_set_direction_registers(display_transfer_mode);
+
+			sbi(P_RST, B_RST);
+			delay(5);
+			cbi(P_RST, B_RST);
+			delay(15);
+			sbi(P_RST, B_RST);
+			delay(15);
+
+			win_valid=false;
+			cbi(P_CS, B_CS);
+
+			switch(model)
+			{
+#ifndef DISABLE_HX8347A
+	#include "tft_drivers/hx8347a/initlcd.h"
+#endif
+#ifndef DISABLE_ILI9327
+	#include "tft_drivers/ili9327/initlcd.h"
+#endif
+#ifndef DISABLE_SSD1289
+	#include "tft_drivers/ssd1289/initlcd.h"
+#endif
+#ifndef DISABLE_ILI9325C
+	#include "tft_drivers/ili9325c/initlcd.h"
+#endif
+#ifndef DISABLE_ILI9325D
+	#include "tft_drivers/ili9325d/default/initlcd.h"
+#endif
+#ifndef DISABLE_ILI9325D_ALT
+	#include "tft_drivers/ili9325d/alt/initlcd.h"
+#endif
+#ifndef DISABLE_HX8340B_8
+	#include "tft_drivers/hx8340b/8/initlcd.h"
+#endif
+#ifndef DISABLE_S1D19122
+	#include "tft_drivers/s1d19122/initlcd.h"
+#endif
+#ifndef DISABLE_HX8352A
+	#include "tft_drivers/hx8352a/initlcd.h"
+#endif
+#ifndef DISABLE_SSD1963_480
+	#include "tft_drivers/ssd1963/480/initlcd.h"
+#endif
+#ifndef DISABLE_SSD1963_800
+	#include "tft_drivers/ssd1963/800/initlcd.h"
+#endif
+#ifndef DISABLE_SSD1963_800_ALT
+	#include "tft_drivers/ssd1963/800alt/initlcd.h"
+#endif
+#ifndef DISABLE_S6D1121
+	#include "tft_drivers/s6d1121/initlcd.h"
+#endif
+#ifndef DISABLE_ILI9481
+	#include "tft_drivers/ili9481/initlcd.h"
+#endif
+#ifndef DISABLE_S6D0164
+	#include "tft_drivers/s6d0164/initlcd.h"
+#endif
+#ifndef DISABLE_R61581
+	#include "tft_drivers/r61581/initlcd.h"
+#endif
+#ifndef DISABLE_ILI9486
+	#include "tft_drivers/ili9486/initlcd.h"
+#endif
+#ifndef DISABLE_CPLD
+	#include "tft_drivers/cpld/initlcd.h"
+#endif
+			}
+
+			sbi(P_CS, B_CS);
+			win_valid=false;
+
+			setColor(255, 255, 255);
+			setBackColor(0, 0, 0);
+		}
+
+		void clrScr()
+		{
+			fillScr(0);
+		}
+
+		void fillScr(byte r, byte g, byte b)
+		{
+			fillScr(((r&248)<<8 | (g&252)<<3 | (b&248)>>3));
+		}
+
+		void fillScr(word color)
+		{
+			byte	ch=byte(color>>8), cl=byte(color & 0xFF);
+
+			cbi(P_CS, B_CS);
+			_set_window(0, 0, getDisplayXSize()-1, getDisplayYSize()-1);
+			_fill(ch, cl, (disp_x_size+1)*(disp_y_size+1));
+			sbi(P_CS, B_CS);
+		}
+
+		void drawPixel(int x, int y)
+		{
+			cbi(P_CS, B_CS);
+			_set_window(x, y, x, y);
+			sbi(P_RS, B_RS);
+			_write(fch, fcl);
+			sbi(P_CS, B_CS);
+		}
+
+		void drawHLine(int x, int y, int l)
+		{
+			if (l<0)
+			{
+				l = -l;
+				x -= l;
+			}
+			cbi(P_CS, B_CS);
+			_set_window(x, y, x+l, y);
+			_fill(fch, fcl, long(l)+1);
+			sbi(P_CS, B_CS);
+		}
+
+		void drawVLine(int x, int y, int l)
+		{
+			if (l<0)
+			{
+				l = -l;
+				y -= l;
+			}
+			cbi(P_CS, B_CS);
+			_set_window(x, y, x, y+l);
+			_fill(fch, fcl, long(l)+1);
+			sbi(P_CS, B_CS);
+		}
+
+		// Bresenham, one window per horizontal (or vertical) run of pixels
+		void drawLine(int x1, int y1, int x2, int y2)
+		{
+			if (y1==y2)
+			{
+				drawHLine(x1, y1, x2-x1);
+				return;
+			}
+			if (x1==x2)
+			{
+				drawVLine(x1, y1, y2-y1);
+				return;
+			}
+
+			int		dx = (x2 > x1 ? x2 - x1 : x1 - x2);
+			short	xstep =  x2 > x1 ? 1 : -1;
+			int		dy = (y2 > y1 ? y2 - y1 : y1 - y2);
+			short	ystep =  y2 > y1 ? 1 : -1;
+			int		col = x1, row = y1;
+
+			cbi(P_CS, B_CS);
+			if (dx >= dy)
+			{
+				int	t = - (dx >> 1);
+				int	start = col;
+
+				while (true)
+				{
+					t += dy;
+					if ((col == x2) || (t >= 0))
+					{
+						_span(start < col ? start : col, row, start < col ? col : start, row);
+						if (col == x2)
+							break;
+						row += ystep;
+						t -= dx;
+						start = col + xstep;
+					}
+					col += xstep;
+				}
+			}
+			else
+			{
+				int	t = - (dy >> 1);
+				int	start = row;
+
+				while (true)
+				{
+					t += dx;
+					if ((row == y2) || (t >= 0))
+					{
+						_span(col, start < row ? start : row, col, start < row ? row : start);
+						if (row == y2)
+							break;
+						col += xstep;
+						t -= dy;
+						start = row + ystep;
+					}
+					row += ystep;
+				}
+			}
+			sbi(P_CS, B_CS);
+		}
+
+		void drawRect(int x1, int y1, int x2, int y2)
+		{
+			if (x1>x2)
+				swap(int, x1, x2);
+			if (y1>y2)
+				swap(int, y1, y2);
+
+			drawHLine(x1, y1, x2-x1);
+			drawHLine(x1, y2, x2-x1);
+			drawVLine(x1, y1, y2-y1);
+			drawVLine(x2, y1, y2-y1);
+		}
+
+		void fillRect(int x1, int y1, int x2, int y2)
+		{
+			if (x1>x2)
+				swap(int, x1, x2);
+			if (y1>y2)
+				swap(int, y1, y2);
+
+			cbi(P_CS, B_CS);
+			_set_window(x1, y1, x2, y2);
+			_fill(fch, fcl, (long(x2-x1)+1)*(long(y2-y1)+1));
+			sbi(P_CS, B_CS);
+		}
+
+		void setColor(byte r, byte g, byte b)
+		{
+			fch=((r&248)|g>>5);
+			fcl=((g&28)<<3|b>>3);
+		}
+
+		void setColor(word color)
+		{
+			fch=byte(color>>8);
+			fcl=byte(color & 0xFF);
+		}
+
+		word getColor()
+		{
+			return (fch<<8) | fcl;
+		}
+
+		void setBackColor(byte r, byte g, byte b)
+		{
+			bch=((r&248)|g>>5);
+			bcl=((g&28)<<3|b>>3);
+		}
+
+		void setBackColor(word color)
+		{
+			bch=byte(color>>8);
+			bcl=byte(color & 0xFF);
+		}
+
+		word getBackColor()
+		{
+			return (bch<<8) | bcl;
+		}
+
+		int getDisplayXSize()
+		{
+			if (orient==PORTRAIT)
+				return disp_x_size+1;
+			else
+				return disp_y_size+1;
+		}
+
+		int getDisplayYSize()
+		{
+			if (orient==PORTRAIT)
+				return disp_y_size+1;
+			else
+				return disp_x_size+1;
+		}
+
+/*
+	The functions and variables below should not normally be used.
+	They have the same meaning as the ones in UTFT.
+*/
+		byte			fch, fcl, bch, bcl;
+		byte			orient;
+		regtype			*P_RS, *P_WR, *P_CS, *P_RST;
+		regsize			B_RS, B_WR, B_CS, B_RST;
+		byte			__p1, __p2, __p3, __p4;
+		word			win_x1, win_y1, win_x2, win_y2;
+		boolean			win_valid;
+
+		inline void _write(byte VH, byte VL)
+		{
+			if (display_transfer_mode==16)
+				_static_write_16(P_RS, B_RS, P_WR, B_WR, VH, VL);
+			else
+				_static_write_8(P_RS, B_RS, P_WR, B_WR, VH, VL);
+		}
+
+		inline void _fill(byte ch, byte cl, long pix)
+		{
+			sbi(P_RS, B_RS);
+			if (display_transfer_mode==16)
+				_static_fill_16(P_RS, B_RS, P_WR, B_WR, ch, cl, pix);
+			else
+				_static_fill_8(P_RS, B_RS, P_WR, B_WR, ch, cl, pix);
+		}
+
+		inline void _span(int x1, int y1, int x2, int y2)
+		{
+			_set_window(x1, y1, x2, y2);
+			_fill(fch, fcl, (long(x2-x1)+1)*(long(y2-y1)+1));
+		}
+
+		inline void LCD_Write_COM(char VL)
+		{
+			cbi(P_RS, B_RS);
+			_write(0x00, VL);
+		}
+
+		inline void LCD_Write_DATA(char VH, char VL)
+		{
+			sbi(P_RS, B_RS);
+			_write(VH, VL);
+		}
+
+		inline void LCD_Write_DATA(char VL)
+		{
+			sbi(P_RS, B_RS);
+			_write(0x00, VL);
+		}
+
+		inline void LCD_Write_COM_DATA(char com1, int dat1)
+		{
+			LCD_Write_COM(com1);
+			LCD_Write_DATA(dat1>>8, dat1);
+		}
+
+		// Takes screen coordinates, used by the primitives above
+		inline void _set_window(word x1, word y1, word x2, word y2)
+		{
+			if (orient==LANDSCAPE)
+			{
+				swap(word, x1, y1);
+				swap(word, x2, y2)
+				y1=disp_y_size-y1;
+				y2=disp_y_size-y2;
+				swap(word, y1, y2)
+			}
+			setXY(x1, y1, x2, y2);
+		}
+
+		// Takes controller coordinates, like UTFT::setXY() after the
+		// orientation has been applied. Used by the init code of some
+		// controllers.
+		void setXY(word x1, word y1, word x2, word y2)
+		{
+			// Window cache, see UTFT::setXY()
+			boolean	set_x1=(!win_valid) or (x1!=win_x1);
+			boolean	set_y1=(!win_valid) or (y1!=win_y1);
+			boolean	set_x2=(!win_valid) or (x2!=win_x2);
+			boolean	set_y2=(!win_valid) or (y2!=win_y2);
+
+			win_x1=x1;
+			win_y1=y1;
+			win_x2=x2;
+			win_y2=y2;
+			win_valid=true;
+
+			switch(model)
+			{
+#ifndef DISABLE_HX8347A
+	#include "tft_drivers/hx8347a/setxy.h"
+#endif
+#ifndef DISABLE_HX8352A
+	#include "tft_drivers/hx8352a/setxy.h"
+#endif
+#ifndef DISABLE_ILI9327
+	#include "tft_drivers/ili9327/setxy.h"
+#endif
+#ifndef DISABLE_SSD1289
+	#include "tft_drivers/ssd1289/setxy.h"
+#endif
+#ifndef DISABLE_ILI9325C
+	#include "tft_drivers/ili9325c/setxy.h"
+#endif
+#ifndef DISABLE_ILI9325D
+	#include "tft_drivers/ili9325d/default/setxy.h"
+#endif
+#ifndef DISABLE_ILI9325D_ALT
+	#include "tft_drivers/ili9325d/alt/setxy.h"
+#endif
+#ifndef DISABLE_HX8340B_8
+	#include "tft_drivers/hx8340b/8/setxy.h"
+#endif
+#ifndef DISABLE_S1D19122
+	#include "tft_drivers/s1d19122/setxy.h"
+#endif
+#ifndef DISABLE_SSD1963_480
+	#include "tft_drivers/ssd1963/480/setxy.h"
+#endif
+#ifndef DISABLE_SSD1963_800
+	#include "tft_drivers/ssd1963/800/setxy.h"
+#endif
+#ifndef DISABLE_SSD1963_800_ALT
+	#include "tft_drivers/ssd1963/800alt/setxy.h"
+#endif
+#ifndef DISABLE_S6D1121
+	#include "tft_drivers/s6d1121/setxy.h"
+#endif
+#ifndef DISABLE_ILI9481
+	#include "tft_drivers/ili9481/setxy.h"
+#endif
+#ifndef DISABLE_S6D0164
+	#include "tft_drivers/s6d0164/setxy.h"
+#endif
+#ifndef DISABLE_R61581
+	#include "tft_drivers/r61581/setxy.h"
+#endif
+#ifndef DISABLE_ILI9486
+	#include "tft_drivers/ili9486/setxy.h"
+#endif
+#ifndef DISABLE_CPLD
+	#include "tft_drivers/cpld/setxy.h"
+#endif
+			}
+		}
+};
+
+#endif
@@ -1,3 +1,20 @@
+// Writes exactly pix pixels on the serial display models
+void UTFT::_fast_fill_serial(byte ch, byte cl, long pix)
+{
+	for (long i=0; i<pix; i++)
+	{
+		LCD_Writ_Bus(0x01,ch,1);
+		LCD_Writ_Bus(0x01,cl,1);
+	}
+}
+
+// Writes exactly pix pixels of any color in 8 bit mode
+void UTFT::_fast_fill_8x2(int ch, int cl, long pix)
+{
+	for (long i=0; i<pix; i++)
+		LCD_Writ_Bus(ch,cl,8);
+}
+
 void UTFT::_convert_float(char *buf, double num, int width, byte prec)
 {
 	char format[10];
@@ -1,6 +1,15 @@
 // *** Hardwarespecific functions ***
 void UTFT::_hw_special_init()
 {
+#if defined(USE_HW_SPI)
+	if (display_transfer_mode==1)
+	{
+		DDRB |= 0x07;					// SS (53), SCK (52) and MOSI (51) are outputs
+		PORTB &= ~0x06;					// SCK idles low while the SPI is disabled
+		SPCR = _BV(SPE) | _BV(MSTR);	// Master, mode 0, MSB first
+		SPSR = _BV(SPI2X);				// F_CPU/2
+	}
+#endif
 }
 
 void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
@@ -8,6 +17,29 @@ void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 	switch (mode)
 	{
 	case 1:
+#if defined(USE_HW_SPI)
+		if (display_serial_mode==SERIAL_4PIN)
+		{
+			// The SPI only sends whole bytes, so the D/C bit is clocked
+			// out by hand with the SPI disabled
+			SPCR &= ~_BV(SPE);
+			if (VH==1)
+				sbi(P_SDA, B_SDA);
+			else
+				cbi(P_SDA, B_SDA);
+			pulse_high(P_SCL, B_SCL);
+			SPCR |= _BV(SPE);
+		}
+		else
+		{
+			if (VH==1)
+				sbi(P_RS, B_RS);
+			else
+				cbi(P_RS, B_RS);
+		}
+		SPDR = VL;
+		while (!(SPSR & _BV(SPIF)));
+#else
 		if (display_serial_mode==SERIAL_4PIN)
 		{
 		if (VH==1)
@@ -64,6 +96,7 @@ void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
 		else
 			cbi(P_SDA, B_SDA);
 		pulse_low(P_SCL, B_SCL);
+#endif
 		break;
 	case 8:
 #if defined(USE_UNO_SHIELD_ON_MEGA)
@@ -237,3 +270,83 @@ void UTFT::_fast_fill_8(int ch, long pix)
 			pulse_low(P_WR, B_WR);pulse_low(P_WR, B_WR);
 		}
 }
+
+// Writes exactly pix pixels of any color in 8 bit mode, the high and the
+// low byte take turns on the bus
+void UTFT::_fast_fill_8x2(int ch, int cl, long pix)
+{
+#if defined(USE_UNO_SHIELD_ON_MEGA)
+	for (long i=0; i<pix; i++)
+		LCD_Writ_Bus(ch, cl, 8);
+#else
+	long blocks;
+
+	blocks = pix/8;
+	for (long i=0; i<blocks; i++)
+	{
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+	}
+	for (int i=0; i<(pix % 8); i++)
+	{
+		PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+	}
+#endif
+}
+
+#if defined(USE_HW_SPI)
+// Writes exactly pix pixels on the serial display models. The bytes are
+// written back to back, SPIF is the only thing waited for.
+void UTFT::_fast_fill_serial(byte ch, byte cl, long pix)
+{
+	if (display_serial_mode==SERIAL_5PIN)
+	{
+		sbi(P_RS, B_RS);
+		for (long i=0; i<pix; i++)
+		{
+			SPDR = ch;
+			while (!(SPSR & _BV(SPIF)));
+			SPDR = cl;
+			while (!(SPSR & _BV(SPIF)));
+		}
+	}
+	else
+	{
+		// With 9 bit words four pixels are 72 bits. They are packed into
+		// 9 bytes once and sent as whole bytes, the rest goes out one
+		// word at a time.
+		byte	block[9];
+		word	acc=0;
+		byte	bits=0, n=0;
+
+		for (byte k=0; k<8; k++)
+		{
+			acc=(acc<<9) | 0x100 | ((k & 1) ? cl : ch);
+			bits+=9;
+			while (bits>=8)
+			{
+				bits-=8;
+				block[n++]=byte(acc>>bits);
+			}
+		}
+
+		for (long i=0; i<pix/4; i++)
+			for (byte j=0; j<9; j++)
+			{
+				SPDR = block[j];
+				while (!(SPSR & _BV(SPIF)));
+			}
+		for (byte i=0; i<(pix & 3); i++)
+		{
+			LCD_Writ_Bus(0x01,ch,1);
+			LCD_Writ_Bus(0x01,cl,1);
+		}
+	}
+}
+#endif
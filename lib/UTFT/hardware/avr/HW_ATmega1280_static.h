@@ -0,0 +1,93 @@
+// *** Hardwarespecific functions for UTFT_Static ***
+// Data bus on PORTA (high byte) and PORTC (low byte) as used by UTFT in
+// 8bit and 16bit mode. The functions are inlined into UTFT_Static, so
+// every bus write is a couple of port stores and one WR pulse.
+
+static inline void _static_set_direction_registers(byte mode)
+{
+	DDRA = 0xFF;
+	if (mode==16)
+		DDRC = 0xFF;
+}
+
+static inline void _static_write_16(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte VH, byte VL)
+{
+	PORTA = VH;
+	PORTC = VL;
+	pulse_low(P_WR, B_WR);
+}
+
+static inline void _static_write_8(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte VH, byte VL)
+{
+	PORTA = VH;
+	pulse_low(P_WR, B_WR);
+	PORTA = VL;
+	pulse_low(P_WR, B_WR);
+}
+
+// Writes exactly pix pixels. The data lines are set once, every following
+// pixel is just another WR pulse.
+static inline void _static_fill_16(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte ch, byte cl, long pix)
+{
+	PORTA = ch;
+	PORTC = cl;
+	while (pix>=8)
+	{
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pulse_low(P_WR, B_WR);
+		pix-=8;
+	}
+	while (pix-->0)
+	{
+		pulse_low(P_WR, B_WR);
+	}
+}
+
+static inline void _static_fill_8(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte ch, byte cl, long pix)
+{
+	if (ch==cl)
+	{
+		PORTA = ch;
+		pix*=2;
+		while (pix>=8)
+		{
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pulse_low(P_WR, B_WR);
+			pix-=8;
+		}
+		while (pix-->0)
+		{
+			pulse_low(P_WR, B_WR);
+		}
+	}
+	else
+	{
+		while (pix>=4)
+		{
+			PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+			PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+			PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+			PORTA = ch;pulse_low(P_WR, B_WR);PORTA = cl;pulse_low(P_WR, B_WR);
+			pix-=4;
+		}
+		while (pix-->0)
+		{
+			PORTA = ch;
+			pulse_low(P_WR, B_WR);
+			PORTA = cl;
+			pulse_low(P_WR, B_WR);
+		}
+	}
+}
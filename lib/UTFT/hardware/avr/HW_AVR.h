@@ -1,3 +1,25 @@
+#if !defined(USE_HW_SPI)
+// Writes exactly pix pixels on the serial display models
+void UTFT::_fast_fill_serial(byte ch, byte cl, long pix)
+{
+	for (long i=0; i<pix; i++)
+	{
+		LCD_Writ_Bus(0x01,ch,1);
+		LCD_Writ_Bus(0x01,cl,1);
+	}
+}
+#endif
+
+#if !(defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__))
+// Writes exactly pix pixels of any color in 8 bit mode. The ATmega1280
+// has its own version writing to the port directly.
+void UTFT::_fast_fill_8x2(int ch, int cl, long pix)
+{
+	for (long i=0; i<pix; i++)
+		LCD_Writ_Bus(ch,cl,8);
+}
+#endif
+
 void UTFT::_convert_float(char *buf, double num, int width, byte prec)
 {
 	dtostrf(num, width, prec, buf);
@@ -7,6 +7,22 @@
 //#define USE_UNO_SHIELD_ON_MEGA 1
 //********************************************************************
 
+// Use the hardware SPI for the serial display models (ILI9341_S5P,
+// ILI9341_S4P, ST7735, ...) instead of bit-banging SDA and SCL
+//
+// ** Currently only available on the Arduino Mega **
+//
+// SDA and SCL have to be connected to MOSI (51) and SCK (52). Pin 53
+// (SS) is switched to output and can not be used as an input.
+//
+// Uncomment the following line to enable this feature
+//#define USE_HW_SPI 1
+//
+#if defined(USE_HW_SPI) && !(defined(__AVR_ATmega1280__) || defined(__AVR_ATmega2560__))
+	#error "USE_HW_SPI is only supported on the ATmega1280/2560!"
+#endif
+//********************************************************************
+
 // *** Hardwarespecific defines ***
 #define cbi(reg, bitmask) *reg &= ~bitmask
 #define sbi(reg, bitmask) *reg |= bitmask
@@ -0,0 +1,525 @@
+// *** Controller model ***
+#define SIM_NONE		0
+#define SIM_SSD1289		1
+#define SIM_ILI9325		2
+#define SIM_HX8347		3
+#define SIM_DCS			4
+#define SIM_CPLD		5
+
+_sim_stats UTFTSim::stats;
+
+static byte		_sim_model;
+static long		_sim_xs, _sim_ys;
+static byte		*_sim_orient = 0;
+static regtype	*_sim_P_CS = 0;
+static regsize	_sim_B_CS;
+static byte		_sim_family = SIM_NONE;
+static word		*_sim_gram = 0;
+static int		_sim_gw, _sim_gh;
+static byte		_sim_pages;
+static byte		_sim_wpage, _sim_dpage;	// GRAM pages written and shown (CPLD)
+static word		_sim_cmd;
+static boolean	_sim_gram_write;
+static int		_sim_wx1, _sim_wy1, _sim_wx2, _sim_wy2;
+static int		_sim_cx, _sim_cy;
+static byte		_sim_hx[0x16];
+static byte		_sim_param[6];
+static byte		_sim_nparam;
+static boolean	_sim_have_hi;
+static byte		_sim_hi;
+static boolean	_sim_last_rs;
+static word		_sim_last_value;
+static int		_sim_tfa, _sim_vsa, _sim_vsp;	// scroll area and the GRAM line shown at its top, no scrolling if _sim_vsa is 0
+static boolean	_sim_vle;
+static int		_sim_vl;
+
+static void _sim_pixel(word color)
+{
+	UTFTSim::stats.pixels++;
+	if ((_sim_cx>=0) && (_sim_cx<_sim_gw) && (_sim_cy>=0) && (_sim_cy<_sim_gh))
+		_sim_gram[(long(_sim_wpage)*_sim_gh+_sim_cy)*_sim_gw+_sim_cx]=color;
+	if (++_sim_cx>_sim_wx2)
+	{
+		_sim_cx=_sim_wx1;
+		if (++_sim_cy>_sim_wy2)
+			_sim_cy=_sim_wy1;
+	}
+}
+
+static void _sim_dcs_params()
+{
+	// Column/page addresses are sent as 16bit (4 parameter bytes) by most
+	// controllers and as 8bit (2 parameter bytes) by the PCF8833
+	int a, b;
+
+	if ((_sim_cmd==0x33) && (_sim_nparam==6))
+	{
+		_sim_tfa=(_sim_param[0]<<8)|_sim_param[1];
+		_sim_vsa=(_sim_param[2]<<8)|_sim_param[3];
+		return;
+	}
+	if ((_sim_cmd==0x37) && (_sim_nparam==2))
+	{
+		_sim_vsp=(_sim_param[0]<<8)|_sim_param[1];
+		return;
+	}
+
+	if (_sim_nparam==4)
+	{
+		a=(_sim_param[0]<<8)|_sim_param[1];
+		b=(_sim_param[2]<<8)|_sim_param[3];
+	}
+	else if (_sim_nparam==2)
+	{
+		a=_sim_param[0];
+		b=_sim_param[1];
+	}
+	else
+		return;
+
+	if (_sim_cmd==0x2a)
+	{
+		_sim_wx1=a;
+		_sim_wx2=b;
+	}
+	else if (_sim_cmd==0x2b)
+	{
+		_sim_wy1=a;
+		_sim_wy2=b;
+	}
+}
+
+static void _sim_command(word cmd)
+{
+	if (_sim_family==SIM_DCS)
+		_sim_dcs_params();
+
+	_sim_cmd=cmd;
+	_sim_nparam=0;
+	_sim_have_hi=false;
+	_sim_gram_write=false;
+
+	switch (_sim_family)
+	{
+	case SIM_SSD1289:
+	case SIM_ILI9325:
+		_sim_gram_write=(cmd==0x22);
+		break;
+	case SIM_HX8347:
+		if (cmd==0x22)
+		{
+			_sim_wx1=(_sim_hx[0x02]<<8)|_sim_hx[0x03];
+			_sim_wx2=(_sim_hx[0x04]<<8)|_sim_hx[0x05];
+			_sim_wy1=(_sim_hx[0x06]<<8)|_sim_hx[0x07];
+			_sim_wy2=(_sim_hx[0x08]<<8)|_sim_hx[0x09];
+			_sim_cx=_sim_wx1;
+			_sim_cy=_sim_wy1;
+			_sim_gram_write=true;
+		}
+		break;
+	case SIM_DCS:
+		if (cmd==0x2c)
+		{
+			_sim_cx=_sim_wx1;
+			_sim_cy=_sim_wy1;
+			_sim_gram_write=true;
+		}
+		break;
+	case SIM_CPLD:
+		// 0x0F latches the registers, the data after it goes to the GRAM
+		if (cmd==0x0F)
+		{
+			_sim_cx=_sim_wx1;
+			_sim_cy=_sim_wy1;
+			_sim_gram_write=true;
+		}
+		break;
+	}
+}
+
+static void _sim_register(word value)
+{
+	switch (_sim_family)
+	{
+	case SIM_SSD1289:
+		switch (_sim_cmd)
+		{
+		case 0x44: _sim_wx1=value & 0xFF; _sim_wx2=value>>8; break;
+		case 0x45: _sim_wy1=value; break;
+		case 0x46: _sim_wy2=value; break;
+		case 0x4e: _sim_cx=value; break;
+		case 0x4f: _sim_cy=value; break;
+		case 0x41: _sim_tfa=0; _sim_vsa=_sim_gh; _sim_vsp=value; break;
+		}
+		break;
+	case SIM_ILI9325:
+		switch (_sim_cmd)
+		{
+		case 0x20: _sim_cx=value; break;
+		case 0x21: _sim_cy=value; break;
+		case 0x50: _sim_wx1=value; break;
+		case 0x51: _sim_wx2=value; break;
+		case 0x52: _sim_wy1=value; break;
+		case 0x53: _sim_wy2=value; break;
+		case 0x61: _sim_vle=(value & 2)!=0; break;
+		case 0x6A: _sim_vl=value; break;
+		}
+		_sim_tfa=0;
+		_sim_vsa=_sim_vle ? _sim_gh : 0;
+		_sim_vsp=_sim_vl;
+		break;
+	case SIM_HX8347:
+		if (_sim_cmd<sizeof(_sim_hx))
+			_sim_hx[_sim_cmd]=value;
+		if ((_sim_model==HX8347A) && (_sim_cmd>=0x0E) && (_sim_cmd<=0x15))
+		{
+			_sim_tfa=(_sim_hx[0x0E]<<8)|_sim_hx[0x0F];
+			_sim_vsa=(_sim_hx[0x10]<<8)|_sim_hx[0x11];
+			_sim_vsp=(_sim_hx[0x14]<<8)|_sim_hx[0x15];
+		}
+		break;
+	case SIM_CPLD:
+		switch (_sim_cmd)
+		{
+		case 0x02: _sim_wy1=value; break;
+		case 0x03: _sim_wx1=value; break;
+		case 0x04: _sim_dpage=(value<_sim_pages) ? value : _sim_pages-1; break;
+		case 0x05: _sim_wpage=(value<_sim_pages) ? value : _sim_pages-1; break;
+		case 0x06: _sim_wy2=value; break;
+		case 0x07: _sim_wx2=value; break;
+		}
+		break;
+	case SIM_DCS:
+		if (_sim_nparam<6)
+			_sim_param[_sim_nparam++]=value;
+		if ((_sim_nparam==4) || ((_sim_cmd==0x33) && (_sim_nparam==6)) || ((_sim_cmd==0x37) && (_sim_nparam==2)))
+			_sim_dcs_params();
+		break;
+	}
+}
+
+static boolean _sim_selected()
+{
+	return (_sim_P_CS!=0) && ((*_sim_P_CS & _sim_B_CS)==0);
+}
+
+void UTFTSim::attach(UTFT *tft)
+{
+	attach(tft->display_model, tft->disp_x_size, tft->disp_y_size, &tft->orient, tft->P_CS, tft->B_CS);
+}
+
+void UTFTSim::attach(byte model, long disp_x_size, long disp_y_size, byte *orient, regtype *P_CS, regsize B_CS)
+{
+	_sim_model=model;
+	_sim_xs=disp_x_size;
+	_sim_ys=disp_y_size;
+	_sim_orient=orient;
+	_sim_P_CS=P_CS;
+	_sim_B_CS=B_CS;
+
+	switch (model)
+	{
+	case SSD1289:
+	case SSD1289_8:
+	case SSD1289LATCHED:
+		_sim_family=SIM_SSD1289;
+		break;
+	case ILI9325C:
+	case ILI9325D_8:
+	case ILI9325D_16:
+	case ILI9325D_16ALT:
+		_sim_family=SIM_ILI9325;
+		break;
+	case HX8347A:
+	case HX8352A:
+	case HX8340B_8:
+		_sim_family=SIM_HX8347;
+		break;
+	case ILI9327:
+	case HX8340B_S:
+	case ST7735:
+	case ST7735S:
+	case ST7735_ALT:
+	case PCF8833:
+	case S1D19122:
+	case SSD1963_480:
+	case SSD1963_800:
+	case SSD1963_800ALT:
+	case ILI9481:
+	case ILI9341_S4P:
+	case ILI9341_S5P:
+	case R61581:
+	case ILI9486:
+	case HX8353C:
+		_sim_family=SIM_DCS;
+		break;
+	case CPLD:
+		_sim_family=SIM_CPLD;
+		break;
+	default:
+		_sim_family=SIM_NONE;
+		break;
+	}
+
+	// The SSD1963 modules are addressed in landscape, see setxy.h
+	if ((model==SSD1963_480) or (model==SSD1963_800) or (model==SSD1963_800ALT))
+	{
+		_sim_gw=disp_y_size+1;
+		_sim_gh=disp_x_size+1;
+	}
+	else
+	{
+		_sim_gw=disp_x_size+1;
+		_sim_gh=disp_y_size+1;
+	}
+
+	_sim_pages=(_sim_family==SIM_CPLD) ? 8 : 1;
+	_sim_wpage=0;
+	_sim_dpage=0;
+
+	free(_sim_gram);
+	_sim_gram=(word*)malloc(long(_sim_gw)*_sim_gh*_sim_pages*sizeof(word));
+
+	_sim_cmd=0;
+	_sim_gram_write=false;
+	_sim_wx1=0;
+	_sim_wy1=0;
+	_sim_wx2=_sim_gw-1;
+	_sim_wy2=_sim_gh-1;
+	_sim_cx=0;
+	_sim_cy=0;
+	_sim_nparam=0;
+	_sim_have_hi=false;
+	memset(_sim_hx, 0, sizeof(_sim_hx));
+	_sim_tfa=0;
+	_sim_vsa=0;
+	_sim_vsp=0;
+	_sim_vle=false;
+	_sim_vl=0;
+
+	clearGRAM();
+	resetStats();
+}
+
+void UTFTSim::resetStats()
+{
+	memset(&stats, 0, sizeof(stats));
+}
+
+void UTFTSim::clearGRAM(word color)
+{
+	for (long i=0; i<long(_sim_gw)*_sim_gh*_sim_pages; i++)
+		_sim_gram[i]=color;
+}
+
+int UTFTSim::getWidth()
+{
+	if (_sim_orient==0)
+		return 0;
+	return (*_sim_orient==PORTRAIT ? _sim_xs : _sim_ys)+1;
+}
+
+int UTFTSim::getHeight()
+{
+	if (_sim_orient==0)
+		return 0;
+	return (*_sim_orient==PORTRAIT ? _sim_ys : _sim_xs)+1;
+}
+
+word UTFTSim::getPixel(int x, int y)
+{
+	int cx=x, cy=y;
+
+	if (_sim_gram==0)
+		return 0;
+	if (*_sim_orient==LANDSCAPE)
+	{
+		cx=y;
+		cy=_sim_ys-x;
+	}
+	// Hardware scrolling: the panel line cy shows another GRAM line
+	if ((_sim_vsa>0) && (cy>=_sim_tfa) && (cy<_sim_tfa+_sim_vsa))
+		cy=_sim_tfa+(((cy-_sim_tfa)+(_sim_vsp-_sim_tfa))%_sim_vsa+_sim_vsa)%_sim_vsa;
+	if (_sim_gw!=_sim_xs+1)
+		swap(int, cx, cy);
+	if ((cx<0) || (cx>=_sim_gw) || (cy<0) || (cy>=_sim_gh))
+		return 0;
+	return _sim_gram[(long(_sim_dpage)*_sim_gh+cy)*_sim_gw+cx];
+}
+
+uint32_t UTFTSim::checksum()
+{
+	// FNV-1a over the image as seen in the current orientation
+	uint32_t h=2166136261UL;
+
+	for (int y=0; y<getHeight(); y++)
+		for (int x=0; x<getWidth(); x++)
+		{
+			word c=getPixel(x, y);
+			h=(h ^ (c & 0xFF))*16777619UL;
+			h=(h ^ (c >> 8))*16777619UL;
+		}
+	return h;
+}
+
+boolean UTFTSim::writePPM(const char *filename)
+{
+	FILE *f=fopen(filename, "wb");
+
+	if (f==0)
+		return false;
+	fprintf(f, "P6\n%d %d\n255\n", getWidth(), getHeight());
+	for (int y=0; y<getHeight(); y++)
+		for (int x=0; x<getWidth(); x++)
+		{
+			word c=getPixel(x, y);
+			byte r=(c>>11) & 0x1F, g=(c>>5) & 0x3F, b=c & 0x1F;
+			fputc((r<<3)|(r>>2), f);
+			fputc((g<<2)|(g>>4), f);
+			fputc((b<<3)|(b>>2), f);
+		}
+	fclose(f);
+	return true;
+}
+
+void UTFTSim::pinWrite(regtype *reg, regsize bitmask, boolean level)
+{
+	boolean old=(*reg & bitmask)!=0;
+
+	if (level)
+		*reg |= bitmask;
+	else
+		*reg &= ~bitmask;
+	if ((reg==_sim_P_CS) && (old!=level))
+		stats.cs_toggles++;
+}
+
+// Writes while CS is high are counted (they cost the MCU the same time)
+// but ignored by the controller, just like on the real bus.
+void UTFTSim::parallelWrite(boolean rs, word value)
+{
+	_sim_last_rs=rs;
+	_sim_last_value=value;
+	if (!rs)
+	{
+		stats.commands++;
+		if (_sim_selected())
+			_sim_command(value);
+	}
+	else
+	{
+		stats.data++;
+		if (!_sim_selected())
+			return;
+		if (_sim_gram_write)
+			_sim_pixel(value);
+		else
+			_sim_register(_sim_family==SIM_DCS ? (value & 0xFF) : value);
+	}
+}
+
+// Another WR pulse with unchanged data lines, which repeats the last write
+void UTFTSim::strobe()
+{
+	parallelWrite(_sim_last_rs, _sim_last_value);
+}
+
+void UTFTSim::serialWrite(boolean dc, byte value)
+{
+	if (!dc)
+	{
+		stats.commands++;
+		if (_sim_selected())
+			_sim_command(value);
+	}
+	else
+	{
+		stats.data++;
+		if (!_sim_selected())
+			return;
+		if (!_sim_gram_write)
+			_sim_register(value);
+		else if (!_sim_have_hi)
+		{
+			_sim_hi=value;
+			_sim_have_hi=true;
+		}
+		else
+		{
+			_sim_pixel((_sim_hi<<8)|value);
+			_sim_have_hi=false;
+		}
+	}
+}
+
+// *** Hardwarespecific functions ***
+void UTFT::_hw_special_init()
+{
+	UTFTSim::attach(this);
+}
+
+void UTFT::LCD_Writ_Bus(char VH,char VL, byte mode)
+{
+	switch (mode)
+	{
+	case 1:
+		UTFTSim::serialWrite(VH==1, VL);
+		break;
+	case 8:
+	case 16:
+	case LATCHED_16:
+		UTFTSim::parallelWrite((*P_RS & B_RS)!=0, (byte(VH)<<8)|byte(VL));
+		break;
+	}
+}
+
+void UTFT::_set_direction_registers(byte mode)
+{
+}
+
+// The fills write the same number of pixels as the AVR versions: whole
+// blocks of 16 plus one more than the remainder.
+void UTFT::_fast_fill_16(int ch, int cl, long pix)
+{
+	long words=(pix/16)*16;
+
+	if ((pix % 16) != 0)
+		words+=(pix % 16)+1;
+	for (long i=0; i<words; i++)
+		UTFTSim::parallelWrite((*P_RS & B_RS)!=0, (byte(ch)<<8)|byte(cl));
+}
+
+void UTFT::_fast_fill_8(int ch, long pix)
+{
+	long words=(pix/16)*16;
+
+	if ((pix % 16) != 0)
+		words+=(pix % 16)+1;
+	for (long i=0; i<words; i++)
+		UTFTSim::parallelWrite((*P_RS & B_RS)!=0, (byte(ch)<<8)|byte(ch));
+}
+
+// Writes exactly pix pixels of any color in 8 bit mode
+void UTFT::_fast_fill_8x2(int ch, int cl, long pix)
+{
+	for (long i=0; i<pix; i++)
+		LCD_Writ_Bus(ch,cl,8);
+}
+
+// Writes exactly pix pixels on the serial display models
+void UTFT::_fast_fill_serial(byte ch, byte cl, long pix)
+{
+	for (long i=0; i<pix; i++)
+	{
+		LCD_Writ_Bus(0x01,ch,1);
+		LCD_Writ_Bus(0x01,cl,1);
+	}
+}
+
+void UTFT::_convert_float(char *buf, double num, int width, byte prec)
+{
+	char format[10];
+
+	sprintf(format, "%%%i.%if", width, prec);
+	sprintf(buf, format, num);
+}
@@ -0,0 +1,63 @@
+// Host simulation (UTFT_HOST_SIM)
+// -------------------------------
+// Instead of driving port pins this backend feeds every bus write into a
+// model of the display controller. The model keeps the address window and
+// the GRAM of the controller, so the result of any draw call can be read
+// back as an RGB565 image together with the bus traffic it caused.
+// The image is what the panel shows, hardware scrolling and the displayed
+// page included.
+//
+// Supported controller families: SSD1289, ILI9325, HX8347/HX8352/HX8340B
+// (8bit), all controllers using the MIPI DCS column/page commands and the
+// CPLD modules with their 8 GRAM pages.
+// Other models are accepted but only the bus statistics are collected.
+//********************************************************************
+
+// *** Hardwarespecific defines ***
+#define cbi(reg, bitmask) UTFTSim::pinWrite(reg, bitmask, false)
+#define sbi(reg, bitmask) UTFTSim::pinWrite(reg, bitmask, true)
+#define pulse_high(reg, bitmask) sbi(reg, bitmask); cbi(reg, bitmask);
+#define pulse_low(reg, bitmask) cbi(reg, bitmask); sbi(reg, bitmask);
+
+#define cport(port, data) port &= data
+#define sport(port, data) port |= data
+
+#define swap(type, i, j) {type t = i; i = j; j = t;}
+
+#define fontbyte(x) pgm_read_byte(&cfont.font[x])
+
+#define regtype volatile uint8_t
+#define regsize uint8_t
+#define bitmapdatatype unsigned short*
+
+class UTFT;
+
+struct _sim_stats
+{
+	unsigned long commands;		// command/register index writes
+	unsigned long data;			// data writes (words, or bytes on serial displays)
+	unsigned long pixels;		// pixels that reached the GRAM
+	unsigned long cs_toggles;	// edges on the CS line
+};
+
+class UTFTSim
+{
+	public:
+		static _sim_stats	stats;
+
+		static void		attach(UTFT *tft);
+		static void		attach(byte model, long disp_x_size, long disp_y_size, byte *orient, regtype *P_CS, regsize B_CS);
+		static void		resetStats();
+		static void		clearGRAM(word color=0);
+		static int		getWidth();
+		static int		getHeight();
+		static word		getPixel(int x, int y);
+		static uint32_t	checksum();
+		static boolean	writePPM(const char *filename);
+
+		// Called from the hardware layer of UTFT
+		static void		pinWrite(regtype *reg, regsize bitmask, boolean level);
+		static void		parallelWrite(boolean rs, word value);
+		static void		serialWrite(boolean dc, byte value);
+		static void		strobe();
+};
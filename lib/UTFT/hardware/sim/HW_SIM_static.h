@@ -0,0 +1,32 @@
+// *** Hardwarespecific functions for UTFT_Static ***
+// Same interface as hardware/avr/HW_ATmega1280_static.h, but the bus
+// writes go to the simulated controller. A repeated WR pulse with
+// unchanged data lines is modelled by UTFTSim::strobe().
+
+static inline void _static_set_direction_registers(byte mode)
+{
+}
+
+static inline void _static_write_16(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte VH, byte VL)
+{
+	UTFTSim::parallelWrite((*P_RS & B_RS)!=0, (VH<<8) | VL);
+}
+
+static inline void _static_write_8(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte VH, byte VL)
+{
+	UTFTSim::parallelWrite((*P_RS & B_RS)!=0, (VH<<8) | VL);
+}
+
+static inline void _static_fill_16(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte ch, byte cl, long pix)
+{
+	if (pix<=0)
+		return;
+	_static_write_16(P_RS, B_RS, P_WR, B_WR, ch, cl);
+	while (--pix>0)
+		UTFTSim::strobe();
+}
+
+static inline void _static_fill_8(regtype *P_RS, regsize B_RS, regtype *P_WR, regsize B_WR, byte ch, byte cl, long pix)
+{
+	_static_fill_16(P_RS, B_RS, P_WR, B_WR, ch, cl, pix);
+}
@@ -0,0 +1,14 @@
+case HX8347A:
+	if (set_area)
+	{
+		LCD_Write_COM_DATA(0x0E,first>>8);
+		LCD_Write_COM_DATA(0x0F,first);
+		LCD_Write_COM_DATA(0x10,(last-first+1)>>8);
+		LCD_Write_COM_DATA(0x11,last-first+1);
+		LCD_Write_COM_DATA(0x12,(disp_y_size-last)>>8);
+		LCD_Write_COM_DATA(0x13,disp_y_size-last);
+	}
+	LCD_Write_COM_DATA(0x14,vsp>>8);
+	LCD_Write_COM_DATA(0x15,vsp);
+	supported=true;
+	break;
@@ -1,13 +1,19 @@
 case HX8353C:
-		LCD_Write_COM(0x2a); 
-  		LCD_Write_DATA(x1>>8);
-  		LCD_Write_DATA(x1);
-  		LCD_Write_DATA(x2>>8);
-  		LCD_Write_DATA(x2);
-		LCD_Write_COM(0x2b); 
-  		LCD_Write_DATA(y1>>8);
-  		LCD_Write_DATA(y1);
-  		LCD_Write_DATA(y2>>8);
-  		LCD_Write_DATA(y2);
-		LCD_Write_COM(0x2c);     
+	if (set_x1 or set_x2)
+	{
+		LCD_Write_COM(0x2a);
+		LCD_Write_DATA(x1>>8);
+		LCD_Write_DATA(x1);
+		LCD_Write_DATA(x2>>8);
+		LCD_Write_DATA(x2);
+	}
+	if (set_y1 or set_y2)
+	{
+		LCD_Write_COM(0x2b);
+		LCD_Write_DATA(y1>>8);
+		LCD_Write_DATA(y1);
+		LCD_Write_DATA(y2>>8);
+		LCD_Write_DATA(y2);
+	}
+	LCD_Write_COM(0x2c);
 	break;
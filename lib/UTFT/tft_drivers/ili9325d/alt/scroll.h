@@ -0,0 +1,9 @@
+case ILI9325D_16ALT:
+	// Only the base image scrolls, as a whole
+	if ((first!=0) or (last!=disp_y_size))
+		break;
+	if (set_area)
+		LCD_Write_COM_DATA(0x61,0x0003); // NDL,VLE, REV
+	LCD_Write_COM_DATA(0x6A,vsp);
+	supported=true;
+	break;
@@ -0,0 +1,16 @@
+case ILI9341_S5P:
+	if (set_area)
+	{
+		LCD_Write_COM(0x33);
+		LCD_Write_DATA(first>>8);
+		LCD_Write_DATA(first);
+		LCD_Write_DATA((last-first+1)>>8);
+		LCD_Write_DATA(last-first+1);
+		LCD_Write_DATA((disp_y_size-last)>>8);
+		LCD_Write_DATA(disp_y_size-last);
+	}
+	LCD_Write_COM(0x37);
+	LCD_Write_DATA(vsp>>8);
+	LCD_Write_DATA(vsp);
+	supported=true;
+	break;
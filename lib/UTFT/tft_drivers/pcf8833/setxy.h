@@ -1,9 +1,15 @@
 case PCF8833:
-	LCD_Write_COM(0x2a); 
-  	LCD_Write_DATA(x1);
-  	LCD_Write_DATA(x2);
-	LCD_Write_COM(0x2b); 
-  	LCD_Write_DATA(y1);
-  	LCD_Write_DATA(y2);
-	LCD_Write_COM(0x2c); 
+	if (set_x1 or set_x2)
+	{
+		LCD_Write_COM(0x2a);
+		LCD_Write_DATA(x1);
+		LCD_Write_DATA(x2);
+	}
+	if (set_y1 or set_y2)
+	{
+		LCD_Write_COM(0x2b);
+		LCD_Write_DATA(y1);
+		LCD_Write_DATA(y2);
+	}
+	LCD_Write_COM(0x2c);
 	break;
@@ -0,0 +1,9 @@
+case SSD1289:
+case SSD1289_8:
+case SSD1289LATCHED:
+	// VL1 scrolls the whole first screen, there are no fixed areas
+	if ((first!=0) or (last!=disp_y_size))
+		break;
+	LCD_Write_COM_DATA(0x41,vsp);
+	supported=true;
+	break;
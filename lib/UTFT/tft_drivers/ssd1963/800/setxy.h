@@ -1,15 +1,23 @@
 case SSD1963_800:
 	swap(word, x1, y1);
 	swap(word, x2, y2);
-	LCD_Write_COM(0x2a); 
-  	LCD_Write_DATA(x1>>8);
-  	LCD_Write_DATA(x1);
-  	LCD_Write_DATA(x2>>8);
-  	LCD_Write_DATA(x2);
-	LCD_Write_COM(0x2b); 
-  	LCD_Write_DATA(y1>>8);
-  	LCD_Write_DATA(y1);
-  	LCD_Write_DATA(y2>>8);
-  	LCD_Write_DATA(y2);
-	LCD_Write_COM(0x2c); 
+	swap(boolean, set_x1, set_y1);
+	swap(boolean, set_x2, set_y2);
+	if (set_x1 or set_x2)
+	{
+		LCD_Write_COM(0x2a);
+		LCD_Write_DATA(x1>>8);
+		LCD_Write_DATA(x1);
+		LCD_Write_DATA(x2>>8);
+		LCD_Write_DATA(x2);
+	}
+	if (set_y1 or set_y2)
+	{
+		LCD_Write_COM(0x2b);
+		LCD_Write_DATA(y1>>8);
+		LCD_Write_DATA(y1);
+		LCD_Write_DATA(y2>>8);
+		LCD_Write_DATA(y2);
+	}
+	LCD_Write_COM(0x2c);
 	break;
@@ -0,0 +1,170 @@
+#include "CDirtyRects.h"
+#include <UTFT.h>
+
+//---------------------------------------------------------------------------------------------------
+
+CDirtyRects::CDirtyRects( UTFT *tft )
+{
+  m_tft       = tft;
+  m_numRects  = 0;
+  m_numLayers = 0;
+  m_frame     = 0;
+
+  resetStats();
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CDirtyRects::resetStats()
+{
+  memset( &m_stats, 0, sizeof(m_stats) );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Layers are painted in the order they were added, the first one at the bottom. Only the
+// part of a dirty rectangle inside x1,y1-x2,y2 is passed to func.
+boolean CDirtyRects::addLayer( int x1, int y1, int x2, int y2, paintFunc func, void *owner )
+{
+  if ( m_numLayers >= DIRTYRECTS_LAYERS ) return false;
+
+  layer *l = &m_layers[m_numLayers++];
+
+  l->bounds.x1 = min( x1, x2 );
+  l->bounds.y1 = min( y1, y2 );
+  l->bounds.x2 = max( x1, x2 );
+  l->bounds.y2 = max( y1, y2 );
+  l->func      = func;
+  l->owner     = owner;
+  return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CDirtyRects::invalidate( int x1, int y1, int x2, int y2 )
+{
+  rect r;
+
+  r.x1 = max( min( x1, x2 ), 0 );
+  r.y1 = max( min( y1, y2 ), 0 );
+  r.x2 = min( max( x1, x2 ), m_tft->getDisplayXSize() - 1 );
+  r.y2 = min( max( y1, y2 ), m_tft->getDisplayYSize() - 1 );
+
+  if ( r.x1 > r.x2 || r.y1 > r.y2 ) return;
+
+  m_stats.invalidated++;
+  add( r );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+static long area( int x1, int y1, int x2, int y2 )
+{
+  return (long)( x2 - x1 + 1 ) * ( y2 - y1 + 1 );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CDirtyRects::add( rect r )
+{
+  // Merge with every rectangle r overlaps or touches, the grown r can touch more of them
+  for ( byte i = 0; i < m_numRects; )
+  {
+    rect *d = &m_rects[i];
+
+    if ( d->x1 <= r.x2 + 1 && d->x2 >= r.x1 - 1 && d->y1 <= r.y2 + 1 && d->y2 >= r.y1 - 1 )
+    {
+      r.x1 = min( r.x1, d->x1 );
+      r.y1 = min( r.y1, d->y1 );
+      r.x2 = max( r.x2, d->x2 );
+      r.y2 = max( r.y2, d->y2 );
+      *d = m_rects[--m_numRects];
+      m_stats.merged++;
+      i = 0;
+    }
+    else
+      i++;
+  }
+
+  if ( m_numRects < DIRTYRECTS_MAX )
+  {
+    m_rects[m_numRects++] = r;
+    return;
+  }
+
+  // All used: merge the pair, r included, whose union adds the least area
+  rect  all[DIRTYRECTS_MAX + 1];
+  byte  bi = 0, bj = 1;
+  long  best = 0x7FFFFFFFL;
+
+  memcpy( all, m_rects, sizeof(m_rects) );
+  all[DIRTYRECTS_MAX] = r;
+
+  for ( byte i = 0; i < DIRTYRECTS_MAX; i++ )
+    for ( byte j = i + 1; j <= DIRTYRECTS_MAX; j++ )
+    {
+      long grow = area( min( all[i].x1, all[j].x1 ), min( all[i].y1, all[j].y1 ),
+                        max( all[i].x2, all[j].x2 ), max( all[i].y2, all[j].y2 ) ) -
+                  area( all[i].x1, all[i].y1, all[i].x2, all[i].y2 ) -
+                  area( all[j].x1, all[j].y1, all[j].x2, all[j].y2 );
+
+      if ( grow < best )
+      {
+        best = grow;
+        bi   = i;
+        bj   = j;
+      }
+    }
+
+  r.x1 = min( all[bi].x1, all[bj].x1 );
+  r.y1 = min( all[bi].y1, all[bj].y1 );
+  r.x2 = max( all[bi].x2, all[bj].x2 );
+  r.y2 = max( all[bi].y2, all[bj].y2 );
+  m_stats.forced++;
+
+  // The union goes in again as it can overlap the others now
+  all[bj] = all[DIRTYRECTS_MAX];
+  all[bi] = all[DIRTYRECTS_MAX - 1];
+  memcpy( m_rects, all, sizeof(m_rects) );
+  m_numRects = DIRTYRECTS_MAX - 1;
+  add( r );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CDirtyRects::paintRect( const rect &r )
+{
+  for ( byte i = 0; i < m_numLayers; i++ )
+  {
+    layer *l  = &m_layers[i];
+    int    x1 = max( r.x1, l->bounds.x1 );
+    int    y1 = max( r.y1, l->bounds.y1 );
+    int    x2 = min( r.x2, l->bounds.x2 );
+    int    y2 = min( r.y2, l->bounds.y2 );
+
+    if ( x1 > x2 || y1 > y2 ) continue;
+
+    m_tft->pushClip( x1, y1, x2, y2 );
+    l->func( l->owner, x1, y1, x2, y2 );
+    m_tft->popClip();
+  }
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Paints all dirty rectangles, bottom layer first
+void CDirtyRects::paint()
+{
+  if ( m_numRects == 0 ) return;
+
+  for ( byte i = 0; i < m_numRects; i++ )
+  {
+    m_stats.rects++;
+    m_stats.pixels += area( m_rects[i].x1, m_rects[i].y1, m_rects[i].x2, m_rects[i].y2 );
+    paintRect( m_rects[i] );
+  }
+
+  m_numRects = 0;
+  m_stats.frames++;
+  m_frame++;
+}
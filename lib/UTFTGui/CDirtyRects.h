@@ -0,0 +1,92 @@
+#ifndef CDIRTYRECTS_H
+#define CDIRTYRECTS_H
+
+#include <Arduino.h>
+#include <UTFT.h>
+
+// Dirty rectangles kept at a time, more are merged
+#ifndef DIRTYRECTS_MAX
+  #define DIRTYRECTS_MAX    6
+#endif
+
+// Widgets that can be registered
+#ifndef DIRTYRECTS_LAYERS
+  #define DIRTYRECTS_LAYERS 8
+#endif
+
+// Frame-level repaint of the widgets. Instead of drawing their updates at once, widgets
+// mark the areas that changed with invalidate() and paint() draws every area once per
+// frame, all widgets under it in z-order:
+//
+//   graph.setDirtyRects( &dirtyRects );     // Registered bottom to top
+//   ...
+//   graph.addData( t, y );                  // Only invalidates
+//   bar.update( v );
+//   dirtyRects.paint();                     // Once per loop() pass
+//
+// Overlapping or touching areas are merged into one. When all DIRTYRECTS_MAX rectangles
+// are used, the two rectangles that grow the least by merging are merged, so a frame never
+// paints more than DIRTYRECTS_MAX rectangles. A merged rectangle can cover pixels nobody
+// invalidated, a layer only draws there what it owns and leaves the rest of the display
+// alone. Widgets with a band buffer composite their own part through it.
+class CDirtyRects
+{
+  public:
+
+    // Draws the widget inside x1,y1-x2,y2, the clip rectangle is set to it
+    typedef void (*paintFunc)( void *owner, int x1, int y1, int x2, int y2 );
+
+    struct stats {
+      unsigned long invalidated;    // invalidate() calls with a visible area
+      unsigned long merged;         // Rectangles merged as they overlapped or touched
+      unsigned long forced;         // Rectangles merged as all were used
+      unsigned long frames;         // paint() calls that drew something
+      unsigned long rects;          // Rectangles painted
+      unsigned long pixels;         // Area of the rectangles painted
+    };
+
+  private:
+
+    struct rect {
+      int x1, y1, x2, y2;
+    };
+
+    struct layer {
+      rect      bounds;
+      paintFunc func;
+      void     *owner;
+    };
+
+    rect  m_rects[DIRTYRECTS_MAX];
+    byte  m_numRects;
+
+    layer m_layers[DIRTYRECTS_LAYERS];
+    byte  m_numLayers;
+
+    unsigned long m_frame;
+
+    stats m_stats;
+
+    UTFT *m_tft;
+
+    void add( rect r );
+    void paintRect( const rect &r );
+
+  public:
+
+    CDirtyRects( UTFT *tft );
+    ~CDirtyRects() {};
+
+    // false if DIRTYRECTS_LAYERS are registered already
+    boolean addLayer( int x1, int y1, int x2, int y2, paintFunc func, void *owner );
+
+    void invalidate( int x1, int y1, int x2, int y2 );
+    void paint();
+    boolean isDirty() { return m_numRects > 0; };
+    unsigned long getFrame() { return m_frame; };   //!< Counts the paint() calls
+
+    const stats &getStats() { return m_stats; };
+    void resetStats();
+};
+
+#endif
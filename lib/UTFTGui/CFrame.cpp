@@ -0,0 +1,66 @@
+#include "CFrame.h"
+#include <UTFT.h>
+
+//---------------------------------------------------------------------------------------------------
+
+CFrame::CFrame( UTFT *tft )
+{
+  m_tft  = tft;
+  m_page = 0;
+
+  m_band     = NULL;
+  m_bandSize = 0;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// buffer holds size RGB565 pixels and is only used without paging. One screen line or more
+// per band keeps the number of callback runs down, e.g. 320 * 8 pixels draw a 320x240
+// screen in 30 bands.
+void CFrame::setBandBuffer( word *buffer, int size )
+{
+  m_band     = ( size > 0 ) ? buffer : NULL;
+  m_bandSize = size;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CFrame::draw( drawFunc func, void *owner )
+{
+  int w = m_tft->getDisplayXSize();
+  int h = m_tft->getDisplayYSize();
+
+  if ( isPaged() )
+  {
+    byte hidden = m_page ^ 1;
+
+    m_tft->setWritePage( hidden );
+    func( owner, 0, 0, w - 1, h - 1 );
+    m_tft->setDisplayPage( hidden );
+    m_page = hidden;
+    return;
+  }
+
+  if ( m_band == NULL )
+  {
+    func( owner, 0, 0, w - 1, h - 1 );
+    return;
+  }
+
+  int cols = constrain( m_bandSize, 1, w );
+  int rows = constrain( m_bandSize / cols, 1, h );
+
+  for ( int y1 = 0; y1 < h; y1 += rows )
+  {
+    int y2 = min( y1 + rows - 1, h - 1 );
+
+    for ( int x1 = 0; x1 < w; x1 += cols )
+    {
+      int x2 = min( x1 + cols - 1, w - 1 );
+
+      m_tft->beginBand( x1, y1, x2, y2, m_band );
+      func( owner, x1, y1, x2, y2 );
+      m_tft->endBand();
+    }
+  }
+}
@@ -0,0 +1,43 @@
+#ifndef CFRAME_H
+#define CFRAME_H
+
+#include <Arduino.h>
+#include <UTFT.h>
+
+// Tear-free redraw of the whole screen, e.g. for a layout change. The widgets are drawn
+// by a callback and only the finished frame becomes visible:
+//
+//  - Controllers with GRAM pages (CPLD): the frame is drawn into the hidden page, which is
+//    then shown. Later drawing goes to the shown page until the next frame.
+//  - Others with a band buffer: the callback runs once per band of the screen and each
+//    band is sent in one window through UTFT::beginBand().
+//  - Others without a buffer: the callback draws straight to the display.
+class CFrame
+{
+  public:
+
+    // Draws the whole frame, background included. The area x1,y1-x2,y2 is the band being
+    // drawn and can be used to skip widgets outside of it.
+    typedef void (*drawFunc)( void *owner, int x1, int y1, int x2, int y2 );
+
+  private:
+
+    word *m_band;
+    int   m_bandSize;
+
+    byte  m_page;     // Page shown, with paging
+
+    UTFT *m_tft;
+
+  public:
+
+    CFrame( UTFT *tft );
+    ~CFrame() {};
+
+    void setBandBuffer( word *buffer, int size );
+    boolean isPaged() { return m_tft->getPageCount() > 1; };
+
+    void draw( drawFunc func, void *owner );
+};
+
+#endif
@@ -1,44 +1,45 @@
 #include "CGraph.h"
 #include <UTFT.h>
 
+// History values besides the samples
+#define HISTORY_EMPTY   GRAPH_SAMPLE_MIN            // Erased, or no sample yet
+#define HISTORY_SKIP    ( GRAPH_SAMPLE_MIN + 1 )    // Inside the segment between two samples
+
+// Flags of gridFlags()
+#define GRID_LINE       1
+#define GRID_DASH       2
+
 void CGraph::setAxisColor( byte r, byte g, byte b )
 {
-  this->axisColor.r = r;
-  this->axisColor.g = g;
-  this->axisColor.b = b;
+  this->axisColor = RGB565( r, g, b );
 }
 
 //---------------------------------------------------------------------------------------------------
 
 void CGraph::setBackgroundColor( byte r, byte g, byte b )
 {
-  this->axisBackgroundColor.r = r;
-  this->axisBackgroundColor.g = g;
-  this->axisBackgroundColor.b = b;
+  this->axisBackgroundColor = RGB565( r, g, b );
 }
 
 //---------------------------------------------------------------------------------------------------
 
 void CGraph::setLineColor( byte r, byte g, byte b )
 {
-  this->lineColor.r = r;
-  this->lineColor.g = g;
-  this->lineColor.b = b;
+  m_traces[0].color = RGB565( r, g, b );
 }
 
 //---------------------------------------------------------------------------------------------------
 
 void CGraph::setGridColor( byte r, byte g, byte b )
 {
-  this->gridColor.r = r;
-  this->gridColor.g = g;
-  this->gridColor.b = b;
+  this->gridColor = RGB565( r, g, b );
 }
 
 //---------------------------------------------------------------------------------------------------
 
 
 CGraph::CGraph(int x, int y, int w, int h, float x0, float xf, float y0, float yf, UTFT *tft)
+  : m_cursor( tft, drawUnder, this )
 {
   this->axisDimensions.x = x;
   this->axisDimensions.y = y;
@@ -51,7 +52,11 @@ CGraph::CGraph(int x, int y, int w, int h, float x0, float xf, float y0, float y
 
   this->m_eraserWidth = 50;  // in pixels
   this->m_oldCursorX  = -1;
-  this->m_oldCursorY  = -1;
+  m_segStartX         = -1;
+  m_numTraces         = 0;
+  m_updOldX           = -1;
+  m_updStartX         = -1;
+  m_updWrap           = false;
 
   m_maxX = x + w - 2;
   m_minX = x + 1;
@@ -65,40 +70,88 @@ CGraph::CGraph(int x, int y, int w, int h, float x0, float xf, float y0, float y
   // Grids
   m_XGridInterval = 0;
   m_YGridInterval = 0;
-  m_oldValX       = x0;
+  m_numGridCols   = 0;
+  m_numGridRows   = 0;
   
   this->m_tft = tft;
 
   m_drawCursor = false;
   m_numDraw    = 0;
 
-  // Default colors
+  m_band     = NULL;
+  m_bandSize = 0;
+
+  m_history        = NULL;
+  m_historySize    = 0;
+  m_historyStride  = 0;
+  m_historyEntries = false;
+  m_historySpans   = false;
+
+  m_autoRange   = false;
+  m_autoMinSpan = 0.0f;
+  m_rescales    = 0;
+
+  m_dirty           = NULL;
+  m_dirtyFrame      = 0;
+  m_transparent     = false;
+  m_numPendColumns  = 0;
+  m_pendCursor      = -1;
+
+  // Default colors, the first trace is always there
   setAxisColor( 255, 255, 255 );
   setBackgroundColor( 12, 12, 12 );
-  setLineColor( 255, 0, 0 );
+  addTrace( 255, 0, 0 );
   setGridColor( 220, 220, 220 );
 }
 
 //---------------------------------------------------------------------------------------------------
 
+// With a history the curve is drawn again from it, over the whole grid, and the sweep goes
+// on where it was. A transparent graph only draws its curve.
 void CGraph::redrawAxis(void)
 {
-  // Draw background
-  m_tft->setColor(axisBackgroundColor.r, axisBackgroundColor.g, axisBackgroundColor.b);
-  m_tft->fillRect(axisDimensions.x + 1, axisDimensions.y + 1, axisDimensions.x + axisDimensions.w - 2, axisDimensions.y + axisDimensions.h - 2);
-  // Draw axis
-  m_tft->setColor(axisColor.r, axisColor.g, axisColor.b);
-  m_tft->drawRect(axisDimensions.x, axisDimensions.y, axisDimensions.x + axisDimensions.w - 1, axisDimensions.y + axisDimensions.h - 1);
+  if ( !m_transparent )
+  {
+    // Draw background and grid
+    drawGridArea( m_minX, m_minY, m_maxX, m_maxY );
+    // Draw axis
+    m_tft->setColor( axisColor );
+    m_tft->drawRect(axisDimensions.x, axisDimensions.y, axisDimensions.x + axisDimensions.w - 1, axisDimensions.y + axisDimensions.h - 1);
+  }
+  m_cursor.discard();
+  m_numPendColumns = 0;
+
+  if ( m_history == NULL )
+    return;
+
+  for ( byte i = 0; i < m_numTraces; i++ )
+    drawHistory( m_history + i * m_historyStride, m_traces[i].color );
+
+  if ( m_drawCursor && !m_transparent && m_oldCursorX >= 0 && m_oldCursorX < m_maxX )
+  {
+    if ( m_band != NULL || m_dirty != NULL )
+    {
+      m_tft->setColor( axisColor );
+      m_tft->drawLine( m_oldCursorX + 1, m_minY, m_oldCursorX + 1, m_maxY );
+    }
+    else
+    {
+      m_cursor.setColor( axisColor );
+      m_cursor.showRect( m_oldCursorX + 1, m_minY, m_oldCursorX + 1, m_maxY );
+    }
+  }
 }
 
 //---------------------------------------------------------------------------------------------------
 
-void CGraph::addData( float t, float val )
+void CGraph::addData( float t, const float *vals )
 {
   // Smart redraw with minimal updates
 
   float dx = this->axisDimensions.xf - this->axisDimensions.x0;
-  int   cursorX, cursorY, cursorYC;
+  int   cursorX, cursorY[GRAPH_TRACES];
+  trace *tr;
+  byte  i;
 
   // Convert to window range, e.g. x0 = 0s, xf = 5s, t = 8.7s --> becomes t = 3.7s (sort-of modulo operator)
   t -= (int)( t / dx ) * dx;
@@ -106,167 +159,633 @@ void CGraph::addData( float t, float val )
   // Calculate cursor pixel position for current time
   cursorX = min( (int)(t / dx * (float)( m_dX ) ) + m_minX, m_maxX );
 
-  // Nothing new to plot?
-  if ( cursorX == this->m_oldCursorX ) return;
+  if ( m_autoRange )
+    autoRange( vals, cursorX != m_oldCursorX );
 
-  // Get new y cursor pixel value and its constrained value wrt. y-axis min/max
-  cursorY  = (int)( (axisDimensions.yf - val) / (axisDimensions.yf - axisDimensions.y0) * (float)(m_dY) ) + m_minY;
-  cursorYC = constrain( cursorY, m_minY, m_maxY );
+  // Get new y cursor pixel values. The unconstrained value is kept for the lines, it is
+  // only limited to stay in int range.
+  for ( i = 0; i < m_numTraces; i++ )
+    cursorY[i] = (int)constrain( (axisDimensions.yf - vals[i]) / (axisDimensions.yf - axisDimensions.y0) * (float)(m_dY),
+                                 -1000.0f, (float)(m_dY) + 1000.0f ) + m_minY;
 
-  // TODO: Clear with eraser width
-
-  // Check for any grids we need to draw up to the current cursor X value
-  // Are there any grid lines between old cursor and current cursor value? if so, draw them first before
-  // we generate the plot lines (otherwise the grid lines would overlay the data plot)
-  if( m_XGridInterval != 0.0f ) {
-    
-    float gridPos = axisDimensions.x0;
-    int gridCursorX, gridCursorY;
-
-    
-    while( gridPos < m_oldValX ) gridPos += m_XGridInterval;
-      
-    while(1)
+  // Nothing new to plot? The samples only widen the envelopes of the column.
+  if ( cursorX == this->m_oldCursorX )
+  {
+    for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
     {
-        if( gridPos > t ) break;
-        
-        // Draw grid at this position
-        gridCursorX = min( (int)(gridPos / dx * (float)( m_dX ) ) + m_minX, m_maxX );
-        
-        m_tft->setColor( this->gridColor.r, this->gridColor.g, this->gridColor.b );
-        
-        // Grid line algorithm for dashed 2x0 2x1 line
-        gridCursorY = m_minY;
-        while(gridCursorY + 1 <= m_maxY) 
-        {
-          m_tft->drawLine( gridCursorX, gridCursorY, gridCursorX, gridCursorY + 1 );
-          gridCursorY += 4;
-        }
-        
-        // Next grid line
-        gridPos += m_XGridInterval;
+      tr->colMinY  = min( tr->colMinY, cursorY[i] );
+      tr->colMaxY  = max( tr->colMaxY, cursorY[i] );
+      tr->colLastY = cursorY[i];
     }
+    return;
   }
-  
-  // Y Grid
-  if( m_YGridInterval != 0.0f ) {
-    
-    float gridPos = m_YGridStart;
-    int gridCursorX, gridCursorY;
-    int dashTemp;
 
-    while(1)
-    {
-        if( gridPos > axisDimensions.yf ) break;
-        
-        // Draw grid at this position
-        gridCursorY = (int)( (axisDimensions.yf - gridPos) / (axisDimensions.yf - axisDimensions.y0) * (float)(m_dY) ) + m_minY;
-        
-        m_tft->setColor( this->gridColor.r, this->gridColor.g, this->gridColor.b );
-        
-        // Grid line algorithm for dashed 2x0 2x1 line
-        if( m_oldCursorX < 0 )
-          gridCursorX = m_minX;
-        else if( m_oldCursorX > cursorX )
-        {
-          gridCursorX = m_oldCursorX+1;
-          // Draw grid lines to end of plot for a clean look and then start from the beginning to the current point
-          while(gridCursorX <= m_maxX) 
-          {
-            dashTemp = ( gridCursorX - m_minX ) % 4;
-            if( dashTemp == 0 || dashTemp == 1 )
-            {
-              m_tft->drawPixel( gridCursorX, gridCursorY );
-            }
-            gridCursorX++;
-          }
-          
-          gridCursorX = m_minX;
-        }
-        else
-        {
-          gridCursorX = m_oldCursorX + 1;
-        }
-        
-        // Draw the line from the last point to the current one
-        while(gridCursorX <= cursorX) 
-        {
-          dashTemp = ( gridCursorX - m_minX ) % 4;
-          if( dashTemp == 0 || dashTemp == 1 )
-          {
-            m_tft->drawPixel( gridCursorX, gridCursorY );
-          }
-          gridCursorX++;
-        }
-        
-        // Next grid line
-        gridPos += m_YGridInterval;
-    }
+  // The curves go on from the last sample of the old column. Its first sample ended the
+  // segment before, the envelope is drawn as a vertical span unless these two cover it.
+  for ( i = 0, tr = m_traces; i < m_numTraces && m_oldCursorX >= 0; i++, tr++ )
+  {
+    boolean span = tr->colMaxY - tr->colMinY > ( tr->colLastY != tr->oldY ? 1 : 0 );
+
+    tr->updEntryY = tr->oldY;
+    tr->updSpanY1 = span ? tr->colMinY : 1;
+    tr->updSpanY2 = span ? tr->colMaxY : 0;
+    tr->oldY      = tr->colLastY;
+    if ( cursorX < m_oldCursorX )
+      tr->updEndY = sweepEndY( tr->oldY, cursorX, cursorY[i] );
+  }
+
+  if ( m_history != NULL )
+    for ( i = 0; i < m_numTraces; i++ )
+      recordHistory( m_history + i * m_historyStride, &m_traces[i], cursorX, cursorY[i] );
+
+  if ( m_band != NULL || m_dirty != NULL )
+  {
+    addDataColumns( cursorX, cursorY );
+    return;
   }
 
+  // The column under the old cursor gets its background and grid back before anything is
+  // drawn over it. drawGridArea() streams it in one window, as a save buffer would.
+  m_cursor.hide();
+
+  // The grid of the new columns is on the display already, laid by the eraser or
+  // redrawAxis()
+
   if ( m_oldCursorX < 0 ) // We started afresh!
   {
-    m_tft->setColor( this->lineColor.r, this->lineColor.g, this->lineColor.b );
-    m_tft->drawPixel( cursorX, cursorYC );
+    for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
+    {
+      m_tft->setColor( tr->color );
+      m_tft->drawPixel( cursorX, constrain( cursorY[i], m_minY, m_maxY ) );
+      tr->oldY = tr->colMinY = tr->colMaxY = tr->colLastY = cursorY[i];
+    }
+    if( m_drawCursor && cursorX < m_maxX ) {
+      m_cursor.setColor( axisColor );
+      m_cursor.showRect( cursorX+1, m_minY, cursorX+1, m_maxY );
+    }
     m_oldCursorX = cursorX;
-    m_oldCursorY = cursorYC;
-    m_oldValX    = t;
     return;
   }
 
+  for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
+    if ( tr->updSpanY1 <= tr->updSpanY2 )
+    {
+      m_tft->setColor( tr->color );
+      drawTrace( m_oldCursorX, tr->updSpanY1, m_oldCursorX, tr->updSpanY2 );
+    }
+
   // Do we start from the beginning again? Interpolate to end of graph for clean display
   if ( cursorX < this->m_oldCursorX )
   {
     m_numDraw++;
     
-    // Calculate interpolated end value
-    int dxE; // Distance to end of plot of last known value
-    int dxP, dyP; // Distance to new point from last known value
-    int cursorYEnd;
+    // First delete stuff at the beginning
+    drawGridArea( m_minX, m_minY, min( cursorX + m_eraserWidth, m_maxX ), m_maxY );
 
+    // Through the interpolated end value
+    for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
+    {
+      m_tft->setColor( tr->color );
+      drawTrace( this->m_oldCursorX, tr->oldY, m_maxX, tr->updEndY );
+      drawTrace( m_minX, tr->updEndY, cursorX, cursorY[i] );
+    }
 
-    dxE = m_maxX - this->m_oldCursorX;
-    dyP = cursorY - this->m_oldCursorY;
-    dxP = cursorX - axisDimensions.x + 1 + dxE;
+  } else {
+    // First delete stuff ahead, the grid is written with the background
+    if ( m_oldCursorX + m_eraserWidth <= min( cursorX + m_eraserWidth, m_maxX ) )
+      drawGridArea( m_oldCursorX + m_eraserWidth, m_minY, min( cursorX + m_eraserWidth, m_maxX ), m_maxY );
 
-    cursorYEnd = constrain( this->m_oldCursorY + (int)((float)dxE / (float)dxP * dyP), axisDimensions.y + 1, axisDimensions.y + axisDimensions.h - 2 );
+    for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
+    {
+      m_tft->setColor( tr->color );
+      drawTrace( this->m_oldCursorX, tr->oldY, cursorX, cursorY[i] );
+    }
+  }
 
-    // TODO draw correctly when running into saturation
+  // Draw cursor
+  if( m_drawCursor && cursorX < m_maxX ) {
+    m_cursor.setColor( axisColor );
+    m_cursor.showRect( cursorX+1, m_minY, cursorX+1, m_maxY );
+  }
 
-    // First delete stuff at the beginning
-    m_tft->setColor( axisBackgroundColor.r, axisBackgroundColor.g, axisBackgroundColor.b );
-    m_tft->fillRect( m_minX, m_minY, min(cursorX + m_eraserWidth, m_maxX), m_maxY );
+  this->m_oldCursorX = cursorX;
+  for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
+    tr->oldY = tr->colMinY = tr->colMaxY = tr->colLastY = cursorY[i];
+}
 
-    m_tft->setColor( this->lineColor.r, this->lineColor.g, this->lineColor.b );
-    m_tft->drawLine( this->m_oldCursorX, this->m_oldCursorY, m_maxX, cursorYEnd );
-    m_tft->drawLine( m_minX, cursorYEnd, cursorX, cursorYC );
-    //drawAALine( this->m_oldCursorX, this->m_oldCursorY, m_maxX, cursorYEnd );
-    //drawAALine( m_minX, cursorYEnd, cursorX, cursorYC );
+//------------------------------------------------------------------------------------
 
-  } else {
-    // First delete stuff at the beginning
-    if ( m_oldCursorX + m_eraserWidth < m_maxX || m_drawCursor )
+// Where the curve from oldY at the old cursor to cursorX, cursorY on the next sweep leaves
+// the plot at its right end, and enters it again at the left end
+int CGraph::sweepEndY( int oldY, int cursorX, int cursorY )
+{
+  int dxE; // Distance to end of plot of last known value
+  int dxP, dyP; // Distance to new point from last known value
+
+  dxE = m_maxX - m_oldCursorX;
+  dyP = cursorY - oldY;
+  dxP = cursorX - axisDimensions.x + 1 + dxE;
+
+  return oldY + (int)((float)dxE / (float)dxP * dyP);
+}
+
+//------------------------------------------------------------------------------------
+
+// Stores the sample of the trace tr in its history h the same way addData() draws it: the columns between the old and the
+// new cursor become part of its segment, the ones under the eraser are emptied. Values are
+// limited to the sample type, which only changes the slope of lines far outside the plot.
+// The old column keeps its last sample, the one the curve goes on from, the row its
+// segment was entered at and its span.
+void CGraph::recordHistory( graphSample *h, const trace *tr, int cursorX, int cursorY )
+{
+  int         n = m_maxX - m_minX + 1;
+  int         c = cursorX - m_minX;
+  int         o = ( m_oldCursorX < 0 ) ? c : m_oldCursorX - m_minX;
+  int         e = min( c + m_eraserWidth, n - 1 );   // Last column of the eraser
+  graphSample endY = 0;
+
+  if ( m_oldCursorX >= 0 )
+  {
+    boolean span = tr->updSpanY1 <= tr->updSpanY2;
+
+    h[o] = constrain( tr->oldY - m_minY, HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX );
+    if ( m_historyEntries )
+      h[n + o] = constrain( tr->updEntryY - m_minY, HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX );
+    if ( m_historySpans )
     {
-      m_tft->setColor( axisBackgroundColor.r, axisBackgroundColor.g, axisBackgroundColor.b );
-      // TODO Fix disappearing grid
-      m_tft->fillRect( m_oldCursorX + m_eraserWidth, m_minY, min(cursorX + m_eraserWidth, m_maxX), m_maxY );
+      h[2 * n + o] = span ? constrain( tr->updSpanY1 - m_minY, HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX ) : HISTORY_EMPTY;
+      h[3 * n + o] = span ? constrain( tr->updSpanY2 - m_minY, HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX ) : HISTORY_EMPTY;
     }
+  }
 
-    m_tft->setColor( this->lineColor.r, this->lineColor.g, this->lineColor.b );
-    m_tft->drawLine( this->m_oldCursorX, this->m_oldCursorY, cursorX, cursorYC );
-    //drawAALine( this->m_oldCursorX, this->m_oldCursorY, cursorX, cursorYC );
+  if ( m_oldCursorX >= 0 && cursorX < m_oldCursorX )
+  {
+    // The old sweep is finished up to the end of the plot, the new one starts with the
+    // same value
+    endY = constrain( tr->updEndY - m_minY, HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX );
+    for ( int i = o + 1; i < n - 1; i++ )
+      h[i] = HISTORY_SKIP;
+    clearColumns( h, o + 1, n - 2 );
+    if ( o < n - 1 )
+      setSample( h, n - 1, endY );
   }
 
-  // Draw cursor
-  if( m_drawCursor && cursorX < m_maxX ) {
-    m_tft->setColor( axisColor.r, axisColor.g, axisColor.b );
-    //m_tft->drawLine( cursorX+1, m_minY, cursorX+1, m_maxY );
+  cutHistory( h, max( c, e ) + 1 );
+
+  if ( m_oldCursorX >= 0 && cursorX < m_oldCursorX )
+  {
+    setSample( h, 0, endY );
+    o = 0;
   }
 
-  this->m_oldCursorX = cursorX;
-  this->m_oldCursorY = cursorYC;
-  this->m_oldValX    = t;
+  for ( int i = o + 1; i < c; i++ )
+    h[i] = HISTORY_SKIP;
+  for ( int i = c + 1; i <= e; i++ )
+    h[i] = HISTORY_EMPTY;
+  clearColumns( h, o + 1, e );
+  setSample( h, c, constrain( cursorY - m_minY, HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX ) );
+}
 
+//------------------------------------------------------------------------------------
+
+// Column i of h becomes a sample at row y, entered at the same row and without span
+void CGraph::setSample( graphSample *h, int i, graphSample y )
+{
+  int n = m_maxX - m_minX + 1;
+
+  h[i] = y;
+  clearColumns( h, i, i );
+  if ( m_historyEntries )
+    h[n + i] = y;
+}
+
+//------------------------------------------------------------------------------------
+
+// Columns a..b got new samples or none, their old entries and spans are gone
+void CGraph::clearColumns( graphSample *h, int a, int b )
+{
+  int n = m_maxX - m_minX + 1;
+
+  for ( int i = a; i <= b; i++ )
+  {
+    if ( m_historyEntries )
+      h[n + i] = HISTORY_EMPTY;
+    if ( m_historySpans )
+      h[2 * n + i] = h[3 * n + i] = HISTORY_EMPTY;
+  }
+}
+
+//------------------------------------------------------------------------------------
+
+// The columns before i are overwritten. A segment running on through column i loses its
+// start, its rest starts at i from now on with the value the segment has there.
+void CGraph::cutHistory( graphSample *h, int i )
+{
+  int n = m_maxX - m_minX + 1;
+  int a = i - 1, b = i + 1;
+  int entryB;
+
+  if ( i >= n || h[i] != HISTORY_SKIP )
+    return;
+
+  while ( a >= 0 && h[a] == HISTORY_SKIP ) a--;
+  while ( b < n && h[b] == HISTORY_SKIP ) b++;
+
+  if ( a < 0 || b >= n || h[a] == HISTORY_EMPTY || h[b] == HISTORY_EMPTY )
+  {
+    h[i] = HISTORY_EMPTY;
+    return;
+  }
+
+  // The segment ends where column b was entered
+  entryB = ( m_historyEntries && h[n + b] > HISTORY_SKIP ) ? h[n + b] : h[b];
+  setSample( h, i, h[a] + (long)( entryB - h[a] ) * ( i - a ) / ( b - a ) );
+}
+
+//------------------------------------------------------------------------------------
+
+// The curve of the history h, every segment as addData() drew it: into the row a column was
+// entered at, its span, and on from its last sample. Without entries the segments run from
+// last sample to last sample, which differs from the display for columns with several
+// samples. Without spans the span of a column is the one between these two rows.
+void CGraph::drawHistory( const graphSample *h, word color )
+{
+  int n = m_maxX - m_minX + 1;
+  int a = -1;   // Previous sample
+
+  m_tft->setColor( color );
+  for ( int i = 0; i < n; i++ )
+  {
+    int entry;
+
+    if ( h[i] == HISTORY_EMPTY )
+      a = -1;
+    if ( h[i] <= HISTORY_SKIP )
+      continue;
+
+    entry = ( m_historyEntries && h[n + i] > HISTORY_SKIP ) ? h[n + i] : h[i];
+    if ( a < 0 )
+      drawTrace( m_minX + i, m_minY + entry, m_minX + i, m_minY + entry );
+    else
+      drawTrace( m_minX + a, m_minY + h[a], m_minX + i, m_minY + entry );
+
+    if ( m_historySpans )
+    {
+      if ( h[2 * n + i] != HISTORY_EMPTY )
+        drawTrace( m_minX + i, m_minY + h[2 * n + i], m_minX + i, m_minY + h[3 * n + i] );
+    }
+    else if ( abs( entry - h[i] ) > 1 )
+      drawTrace( m_minX + i, m_minY + entry, m_minX + i, m_minY + h[i] );
+    a = i;
+  }
+}
+
+//------------------------------------------------------------------------------------
+
+// Composited update: every changed column is drawn completely (background, grid, curve
+// and cursor) in the off-screen band and sent to the display in one window, so nothing
+// is drawn twice and the grid and the curve never flicker. With a dirty rectangle
+// manager the columns are drawn the same way by its next paint().
+void CGraph::addDataColumns( int cursorX, const int *cursorY )
+{
+  int    cursorCol = ( m_drawCursor && cursorX < m_maxX ) ? cursorX + 1 : -1;
+  trace *tr;
+  byte   i;
+
+  if ( m_dirty != NULL )
+  {
+    // The columns of the previous update have to be on the display first
+    if ( m_numPendColumns > 0 && m_dirty->getFrame() == m_dirtyFrame )
+      m_dirty->paint();
+
+    m_dirtyFrame     = m_dirty->getFrame();
+    m_numPendColumns = 0;
+    m_pendCursor     = cursorCol;
+  }
+
+  // The update drawn by drawArea(), the traces go on from here
+  m_updStartX = m_segStartX;
+  m_updOldX   = m_oldCursorX;
+  m_updWrap   = ( m_oldCursorX >= 0 && cursorX < m_oldCursorX );
+
+  for ( i = 0, tr = m_traces; i < m_numTraces; i++, tr++ )
+  {
+    tr->updStartY = tr->segStartY;
+    tr->updLastY  = tr->oldY;
+    tr->segStartY = ( m_oldCursorX < 0 ) ? cursorY[i] : m_updWrap ? tr->updEndY : tr->oldY;
+    tr->oldY      = tr->colMinY = tr->colMaxY = tr->colLastY = cursorY[i];
+  }
+  m_segStartX  = ( m_oldCursorX < 0 ) ? cursorX : m_updWrap ? m_minX : m_oldCursorX;
+  m_oldCursorX = cursorX;
+
+  if ( m_updOldX < 0 ) // We started afresh!
+    updateColumns( cursorX, cursorCol < 0 ? cursorX : cursorCol, cursorCol );
+  else if ( m_updWrap ) // Start from the beginning again
+  {
+    m_numDraw++;
+
+    // Finish the old sweep up to the end of the plot, this also removes the old cursor
+    updateColumns( m_updOldX, m_maxX, -1 );
+
+    // The new sweep and the eraser in front of it
+    updateColumns( m_minX, min( max( cursorX + m_eraserWidth, cursorCol ), m_maxX ), cursorCol );
+  }
+  else
+  {
+    // The column of the old cursor still shows the end of the previous segment, which is
+    // drawn again together with the new one. The old cursor is overdrawn by the new columns.
+    updateColumns( m_updOldX, cursorCol < 0 ? cursorX : cursorCol, cursorCol );
+
+    // Eraser, it leaves the grid in place
+    int eraseX1 = max( m_updOldX + m_eraserWidth, ( cursorCol < 0 ? cursorX : cursorCol ) + 1 );
+    int eraseX2 = min( cursorX + m_eraserWidth, m_maxX );
+    if ( eraseX1 <= eraseX2 )
+      updateColumns( eraseX1, eraseX2, -1 );
+  }
+}
+
+//------------------------------------------------------------------------------------
+
+// The segments of the last update of the trace tr, x1, y1, x2, y2 each: the one ending at
+// the first sample of the old column, its span, and the ones from its last sample to the
+// new cursor. Just the new point on the first sample.
+int CGraph::updateSegments( const trace *tr, int *segments )
+{
+  int n = 0;
+
+  if ( m_updOldX < 0 )
+  {
+    segments[0] = segments[2] = m_oldCursorX;
+    segments[1] = segments[3] = tr->oldY;
+    return 1;
+  }
+
+  segments[n * 4 + 0] = m_updStartX;   segments[n * 4 + 1] = tr->updStartY;
+  segments[n * 4 + 2] = m_updOldX;     segments[n * 4 + 3] = tr->updEntryY;
+  n++;
+  if ( tr->updSpanY1 <= tr->updSpanY2 )
+  {
+    segments[n * 4 + 0] = m_updOldX;   segments[n * 4 + 1] = tr->updSpanY1;
+    segments[n * 4 + 2] = m_updOldX;   segments[n * 4 + 3] = tr->updSpanY2;
+    n++;
+  }
+  if ( m_updWrap )
+  {
+    segments[n * 4 + 0] = m_updOldX;   segments[n * 4 + 1] = tr->updLastY;
+    segments[n * 4 + 2] = m_maxX;      segments[n * 4 + 3] = tr->updEndY;
+    n++;
+    segments[n * 4 + 0] = m_minX;      segments[n * 4 + 1] = tr->updEndY;
+  }
+  else
+  {
+    segments[n * 4 + 0] = m_updOldX;   segments[n * 4 + 1] = tr->updLastY;
+  }
+  segments[n * 4 + 2] = m_oldCursorX;  segments[n * 4 + 3] = tr->oldY;
+  return n + 1;
+}
+
+//------------------------------------------------------------------------------------
+
+// Columns xa..xb changed: drawn at once through the band buffer, or recorded for the
+// next paint() of the dirty rectangle manager
+void CGraph::updateColumns( int xa, int xb, int cursorX )
+{
+  if ( m_dirty == NULL )
+  {
+    drawColumns( xa, m_minY, xb, m_maxY, cursorX );
+    return;
+  }
+
+  m_pendColumns[m_numPendColumns].x1 = xa;
+  m_pendColumns[m_numPendColumns].x2 = xb;
+  m_numPendColumns++;
+
+  m_dirty->invalidate( xa, m_minY, xb, m_maxY );
+}
+
+//------------------------------------------------------------------------------------
+
+// Draws the rows ya..yb of the plot columns xa..xb from scratch, in as many bands as the
+// buffer needs. cursorX is -1 without cursor.
+void CGraph::drawColumns( int xa, int ya, int xb, int yb, int cursorX )
+{
+  int rows   = yb - ya + 1;
+  int cols   = constrain( m_bandSize / rows, 1, xb - xa + 1 );
+  int bRows  = constrain( m_bandSize / cols, 1, rows );
+
+  for ( int x1 = xa; x1 <= xb; x1 += cols )
+  {
+    int x2 = min( x1 + cols - 1, xb );
+
+    for ( int y1 = ya; y1 <= yb; y1 += bRows )
+    {
+      int y2 = min( y1 + bRows - 1, yb );
+
+      m_tft->beginBand( x1, y1, x2, y2, m_band );
+      drawArea( x1, y1, x2, y2, cursorX );
+      m_tft->endBand();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------------
+
+// Background, grid, the segments of the last update of every trace and cursor of the plot
+// area x1,y1-x2,y2. A transparent graph only draws its segments over the graph below it.
+void CGraph::drawArea( int x1, int y1, int x2, int y2, int cursorX )
+{
+  if ( !m_transparent )
+    drawGridArea( x1, y1, x2, y2 );
+
+  for ( byte t = 0; t < m_numTraces; t++ )
+  {
+    int segments[4 * 4];
+    int numSegments = updateSegments( &m_traces[t], segments );
+
+    m_tft->setColor( m_traces[t].color );
+    for ( int i = 0; i < numSegments; i++ )
+    {
+      const int *s = &segments[i * 4];
+
+      // Only the part of the segment inside the area is drawn
+      if ( max( s[0], s[2] ) >= x1 && min( s[0], s[2] ) <= x2 )
+        drawTrace( s[0], s[1], s[2], s[3] );
+    }
+  }
+
+  if ( !m_transparent && cursorX >= x1 && cursorX <= x2 )
+  {
+    m_tft->setColor( axisColor );
+    m_tft->drawLine( cursorX, y1, cursorX, y2 );
+  }
+}
+
+//------------------------------------------------------------------------------------
+
+// Called by the dirty rectangle manager for every dirty area over the plot. Only the
+// columns of the last update are drawn, the rest of the plot is still on the display.
+// With a band buffer they are sent composited, a transparent graph always draws directly
+// over them.
+void CGraph::paintLayer( void *graph, int x1, int y1, int x2, int y2 )
+{
+  CGraph *g = (CGraph *)graph;
+
+  for ( byte i = 0; i < g->m_numPendColumns; i++ )
+  {
+    int xa = max( x1, g->m_pendColumns[i].x1 );
+    int xb = min( x2, g->m_pendColumns[i].x2 );
+
+    if ( xa > xb ) continue;
+
+    g->m_tft->pushClip( xa, y1, xb, y2 );
+    if ( g->m_band != NULL && !g->m_transparent )
+      g->drawColumns( xa, y1, xb, y2, g->m_pendCursor );
+    else
+      g->drawArea( xa, y1, xb, y2, g->m_pendCursor );
+    g->m_tft->popClip();
+  }
+}
+
+//------------------------------------------------------------------------------------
+
+// Background and grid of the plot area x1,y1-x2,y2 as one window, in the write order of the
+// display: column by column from right to left, or row by row. A pixel is on the grid if it
+// is on a line of one axis and in a dash across it, the lines are dashed 2 on, 2 off from
+// m_minX and m_minY. Runs of one color, also across lines of the window, go out as one fill.
+void CGraph::drawGridArea( int x1, int y1, int x2, int y2 )
+{
+  boolean byCols = ( m_tft->getWriteOrder() == LANDSCAPE );
+  int     u1 = byCols ? x1 : y1, u2 = byCols ? x2 : y2;    // Lines of the window
+  int     v1 = byCols ? y1 : x1, v2 = byCols ? y2 : x2;    // Pixels of a line
+  byte    across = byCols ? m_numGridRows : m_numGridCols;
+  word    color = axisBackgroundColor;
+  long    run   = 0;
+
+  m_tft->beginWrite( x1, y1, x2, y2, byCols ? LANDSCAPE : PORTRAIT );
+
+  for ( int k = 0; k <= u2 - u1; k++ )
+  {
+    byte i  = 0;
+    byte fu = gridFlags( byCols, byCols ? u2 - k : u1 + k, &i );
+
+    // Plain background line
+    if ( !( fu & GRID_LINE ) && ( !( fu & GRID_DASH ) || across == 0 ) )
+    {
+      if ( color != axisBackgroundColor )
+      {
+        m_tft->pushColor( color, run );
+        color = axisBackgroundColor;
+        run   = 0;
+      }
+      run += v2 - v1 + 1;
+      continue;
+    }
+
+    i = 0;
+    for ( int v = v1; v <= v2; v++ )
+    {
+      byte fv  = gridFlags( !byCols, v, &i );
+      word pix = ( ( fu & GRID_LINE ) && ( fv & GRID_DASH ) ) || ( ( fu & GRID_DASH ) && ( fv & GRID_LINE ) ) ?
+                 gridColor : axisBackgroundColor;
+
+      if ( pix != color )
+      {
+        m_tft->pushColor( color, run );
+        color = pix;
+        run   = 0;
+      }
+      run++;
+    }
+  }
+
+  m_tft->pushColor( color, run );
+  m_tft->endWrite();
+}
+
+//------------------------------------------------------------------------------------
+
+// GRID_LINE if the column p, or the row p if not x, has a grid line, GRID_DASH if it is in
+// a dash of the lines across it. The positions have to ascend between the calls with the
+// same line index i.
+byte CGraph::gridFlags( boolean x, int p, byte *i )
+{
+  const int *lines = x ? m_gridCols : m_gridRows;
+  byte       n     = x ? m_numGridCols : m_numGridRows;
+  int        d     = x ? ( p - m_minX ) % 4 : ( p - m_minY ) % 4;
+  byte       f     = 0;
+
+  while ( *i < n && lines[*i] < p ) (*i)++;
+  if ( *i < n && lines[*i] == p )
+    f |= GRID_LINE;
+
+  // The dashes of the x grid lines end with the last complete pair
+  if ( d < 2 && ( x || p - d + 1 <= m_maxY ) )
+    f |= GRID_DASH;
+  return f;
+}
+
+//------------------------------------------------------------------------------------
+
+// Grid lines for the current intervals and range, drawn by drawGridArea()
+void CGraph::updateGrid()
+{
+  float dx = axisDimensions.xf - axisDimensions.x0;
+
+  m_numGridCols = 0;
+  m_numGridRows = 0;
+
+  if ( m_XGridInterval != 0.0f )
+    for ( float gridPos = axisDimensions.x0; gridPos < dx && m_numGridCols < GRAPH_GRID_LINES; gridPos += m_XGridInterval )
+      m_gridCols[m_numGridCols++] = min( (int)(gridPos / dx * (float)( m_dX ) ) + m_minX, m_maxX );
+
+  // Bottom up, stored top down
+  if ( m_YGridInterval != 0.0f )
+    for ( float gridPos = m_YGridStart; gridPos <= axisDimensions.yf && m_numGridRows < GRAPH_GRID_LINES; gridPos += m_YGridInterval )
+    {
+      for ( byte i = m_numGridRows; i > 0; i-- )
+        m_gridRows[i] = m_gridRows[i - 1];
+      m_gridRows[0] = (int)( (axisDimensions.yf - gridPos) / (axisDimensions.yf - axisDimensions.y0) * (float)(m_dY) ) + m_minY;
+      m_numGridRows++;
+    }
+}
+
+//------------------------------------------------------------------------------------
+
+// Background and grid of the plot area inside x1,y1-x2,y2, for the cursor overlay
+void CGraph::drawUnder( void *graph, int x1, int y1, int x2, int y2 )
+{
+  CGraph *g = (CGraph *)graph;
+
+  g->m_tft->pushClip( x1, y1, x2, y2 );
+  g->drawGridArea( x1, y1, x2, y2 );
+  g->m_tft->popClip();
+}
+
+//------------------------------------------------------------------------------------
+
+// Curve segment between two unconstrained cursor positions. The part inside the plot
+// area keeps its true slope, the saturated parts run along the upper or lower edge.
+void CGraph::drawTrace( int x1, int y1, int x2, int y2 )
+{
+  m_tft->pushClip( m_minX, m_minY, m_maxX, m_maxY );
+  m_tft->drawLine( x1, y1, x2, y2 );
+
+  for ( int e = 0; e < 2; e++ )
+  {
+    int     edge = e ? m_maxY : m_minY;
+    boolean out1 = e ? y1 > edge : y1 < edge;
+    boolean out2 = e ? y2 > edge : y2 < edge;
+    int     xa = x1, xb = x2;
+
+    if ( !out1 && !out2 ) continue;
+
+    // Where the segment crosses the edge, y1 != y2 as only one end is outside
+    if ( !out1 ) xa = x1 + (long)( edge - y1 ) * ( x2 - x1 ) / ( y2 - y1 );
+    if ( !out2 ) xb = x1 + (long)( edge - y1 ) * ( x2 - x1 ) / ( y2 - y1 );
+    m_tft->drawLine( xa, edge, xb, edge );
+  }
+
+  m_tft->popClip();
 }
 
 //------------------------------------------------------------------------------------
@@ -278,8 +797,11 @@ void CGraph::drawAALine( int x1, int y1, int x2, int y2 )
   uint16_t ErrorAccTemp, Weighting, WeightingComplementMask;
   int16_t DeltaX, DeltaY, Temp, XDir;
   const int16_t BaseColor = 0;
-  const int16_t numLevels = 256;
-  const uint16_t intensityBits = 8;
+  const int16_t numLevels = 32;
+  const uint16_t intensityBits = 5;
+  word blend[numLevels];    /* line color at 0 to background at numLevels - 1 */
+
+  m_tft->makeBlendTable(blend, numLevels, m_traces[0].color, axisBackgroundColor);
 
   /* Make sure the line runs top to bottom */
   if (y1 > y2) {
@@ -288,7 +810,7 @@ void CGraph::drawAALine( int x1, int y1, int x2, int y2 )
   }
   /* Draw the initial pixel, which is always exactly intersected by
      the line and so needs no weighting */
-  m_tft->setColor(lineColor.r, lineColor.g, lineColor.b);
+  m_tft->setColor( m_traces[0].color );
   m_tft->drawPixel(x1, y1);
 
   if ((DeltaX = x2 - x1) >= 0) {
@@ -341,14 +863,14 @@ void CGraph::drawAALine( int x1, int y1, int x2, int y2 )
          intensity weighting for this pixel, and the complement of the
          weighting for the paired pixel */
       Weighting = ErrorAcc >> IntensityShift;
-      drawAAPixel(x1, y1, BaseColor + Weighting);
+      drawAAPixel(x1, y1, blend[BaseColor + Weighting]);
       drawAAPixel(x1 + XDir, y1,
-                        BaseColor + (Weighting ^ WeightingComplementMask));
+                        blend[BaseColor + (Weighting ^ WeightingComplementMask)]);
     }
     /* Draw the final pixel, which is
        always exactly intersected by the line
        and so needs no weighting */
-    drawAAPixel(x2, y2, BaseColor);
+    drawAAPixel(x2, y2, blend[BaseColor]);
     return;
   }
   /* It's an X-major line; calculate 16-bit fixed-point fractional part of a
@@ -368,27 +890,20 @@ void CGraph::drawAALine( int x1, int y1, int x2, int y2 )
        intensity weighting for this pixel, and the complement of the
        weighting for the paired pixel */
     Weighting = ErrorAcc >> IntensityShift;
-    drawAAPixel(x1, y1, BaseColor + Weighting);
+    drawAAPixel(x1, y1, blend[BaseColor + Weighting]);
     drawAAPixel(x1, y1 + 1,
-                      BaseColor + (Weighting ^ WeightingComplementMask));
+                      blend[BaseColor + (Weighting ^ WeightingComplementMask)]);
   }
   /* Draw the final pixel, which is always exactly intersected by the line
      and so needs no weighting */
-  drawAAPixel(x2, y2, BaseColor);
+  drawAAPixel(x2, y2, blend[BaseColor]);
 }
 
 //---------------------------------------------------------------------------------------------------
 
-void CGraph::drawAAPixel( int x1, int y1, int colorGrad )
+void CGraph::drawAAPixel( int x1, int y1, word color )
 {
-  // Interpolate color
-  byte r, g, b;
-
-  r = map( colorGrad, 0, 255, lineColor.r, axisBackgroundColor.r );
-  g = map( colorGrad, 0, 255, lineColor.g, axisBackgroundColor.g );
-  b = map( colorGrad, 0, 255, lineColor.b, axisBackgroundColor.b );
-  
-  m_tft->setColor(r,g,b);
+  m_tft->setColor( color );
   m_tft->drawPixel( x1, y1 );
 }
 
@@ -397,6 +912,7 @@ void CGraph::drawAAPixel( int x1, int y1, int colorGrad )
 void CGraph::setXGridInterval( float ival )
 {
   m_XGridInterval = ival;
+  updateGrid();
 }
 
 //---------------------------------------------------------------------------------------------------
@@ -409,6 +925,8 @@ void CGraph::setYGridInterval( float ival )
   // Get lowest grid line value (searching from zero)
   while( m_YGridStart - m_YGridInterval > axisDimensions.y0 ) m_YGridStart -= m_YGridInterval;
   while( m_YGridStart < axisDimensions.y0 )                   m_YGridStart += m_YGridInterval; 
+
+  updateGrid();
 }
 
 //---------------------------------------------------------------------------------------------------
@@ -417,3 +935,258 @@ void CGraph::setEraserPixelWidth( int ival )
 {
   m_eraserWidth = ival;
 }
+
+//---------------------------------------------------------------------------------------------------
+
+// The cursor is a line in the column after the newest point. In front of the curve the
+// plot area holds only background and grid, so the cursor is moved by drawing these again
+// in its old column. Of two graphs sharing their area only one should draw a cursor, the
+// other one's curve would be cut by it.
+void CGraph::setCursor( boolean bEnable )
+{
+  if ( !bEnable )
+    m_cursor.hide();
+  this->m_drawCursor = bEnable;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Enables composited drawing through UTFT::beginBand(). buffer holds size RGB565 pixels and
+// can be shared by several graphs. It should hold at least one column of the plot area
+// (height - 2 pixels); more columns per band mean fewer windows. Changed columns are
+// redrawn completely, so graphs sharing their area overwrite each other's curves.
+void CGraph::setBandBuffer( word *buffer, int size )
+{
+  m_band     = ( size > 0 ) ? buffer : NULL;
+  m_bandSize = size;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Registers the graph as a layer of dirty, on top of the layers registered before. addData()
+// then only marks the changed columns and dirty->paint() draws them, composited like with a
+// band buffer. Graphs sharing their area are registered bottom to top, the upper ones with
+// setTransparent(), and need the same x-axis so they change the same columns. A band
+// buffer set with setBandBuffer() is used for the composited columns.
+void CGraph::setDirtyRects( CDirtyRects *dirty )
+{
+  m_cursor.hide();
+  m_dirty          = dirty;
+  m_numPendColumns = 0;
+  if ( dirty != NULL )
+    dirty->addLayer( m_minX, m_minY, m_maxX, m_maxY, paintLayer, this );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// A transparent graph draws no background, grid or cursor, only its curve over the graph
+// below it. For composited drawing with setDirtyRects().
+void CGraph::setTransparent( boolean bEnable )
+{
+  m_transparent = bEnable;
+}
+
+
+//---------------------------------------------------------------------------------------------------
+
+// Keeps the curve of the graph, so redrawAxis(), setYRange() and screen changes draw it
+// again instead of clearing it. buffer holds one sample per plot column (width - 2), 268
+// bytes for a graph 270 pixels wide. The samples are the pixel rows of the curve, int8_t
+// holds them for plot areas up to about 120 pixels high, see GRAPH_HISTORY_16BIT. Columns
+// with several samples need two per column to be drawn again as they were, the row the
+// curve entered them at as well; with up to two samples per column that is exact. Four per
+// column keep their spans, the envelope of all their samples, as well. Every trace needs
+// its own, size is divided among them.
+void CGraph::setHistoryBuffer( graphSample *buffer, int size )
+{
+  int n = m_maxX - m_minX + 1;
+
+  m_historySize    = size;
+  m_historyStride  = size / m_numTraces;
+  m_historySpans   = ( m_historyStride >= 4 * n );
+  m_historyEntries = ( m_historyStride >= 2 * n );
+  m_history        = ( m_historyStride >= n ) ? buffer : NULL;
+  m_historyStride  = m_historySpans ? 4 * n : m_historyEntries ? 2 * n : n;
+  if ( m_history != NULL )
+    for ( int i = 0; i < m_numTraces * m_historyStride; i++ )
+      m_history[i] = HISTORY_EMPTY;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+static int rescaleRow( int row, float k, float offset )
+{
+  return (int)floor( (float)row * k + offset + 0.5f );
+}
+
+static int rescaleCursor( int row, int minY, int dY, float k, float offset )
+{
+  return minY + constrain( rescaleRow( row - minY, k, offset ), -1000, dY + 1000 );
+}
+
+// Changes the y-axis to y0..yf and redraws the graph, the history is converted to the new
+// range. Of graphs sharing their area all have to be redrawn, bottom to top.
+void CGraph::setYRange( float y0, float yf )
+{
+  // Row p of the old range shows yf - p / m_dY * ( yf - y0 )
+  float k      = ( axisDimensions.yf - axisDimensions.y0 ) / ( yf - y0 );
+  float offset = ( yf - axisDimensions.yf ) / ( yf - y0 ) * (float)( m_dY );
+
+  if ( m_history != NULL )
+    for ( int i = 0; i < m_numTraces * m_historyStride; i++ )
+      if ( m_history[i] > HISTORY_SKIP )
+        m_history[i] = constrain( rescaleRow( m_history[i], k, offset ), HISTORY_SKIP + 1, GRAPH_SAMPLE_MAX );
+
+  for ( byte i = 0; i < m_numTraces && m_oldCursorX >= 0; i++ )
+  {
+    trace *tr = &m_traces[i];
+
+    tr->oldY      = rescaleCursor( tr->oldY, m_minY, m_dY, k, offset );
+    tr->segStartY = rescaleCursor( tr->segStartY, m_minY, m_dY, k, offset );
+    tr->colMinY   = rescaleCursor( tr->colMinY, m_minY, m_dY, k, offset );
+    tr->colMaxY   = rescaleCursor( tr->colMaxY, m_minY, m_dY, k, offset );
+    tr->colLastY  = rescaleCursor( tr->colLastY, m_minY, m_dY, k, offset );
+  }
+
+  axisDimensions.y0 = y0;
+  axisDimensions.yf = yf;
+  if ( m_YGridInterval != 0.0f )
+    setYGridInterval( m_YGridInterval );
+
+  redrawAxis();
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Lets addData() choose the y-axis. A value outside the range expands it at once, to round
+// limits around the curve on display and the value. At the start of each column the range
+// shrinks when the curve would fit into half of it, so the range doesn't go back and forth
+// when the curve stays near the limits. Every change redraws the graph like setYRange(),
+// at most once per addData(). The range is at least minSpan high, the Y grid interval is set
+// to the rounding step. Shrinking needs the history, see setHistoryBuffer(); without one an
+// expansion clears the curve. Graphs sharing their area also share the axis, they should
+// keep a fixed range.
+void CGraph::setAutoRange( boolean bEnable, float minSpan )
+{
+  m_autoRange   = bEnable;
+  m_autoMinSpan = minSpan;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Lowest and highest row of the curves on display, false without any
+boolean CGraph::visibleRows( int *top, int *bottom )
+{
+  if ( m_oldCursorX < 0 )
+    return false;
+
+  *top    = m_traces[0].colMinY;
+  *bottom = m_traces[0].colMaxY;
+  for ( byte i = 1; i < m_numTraces; i++ )
+  {
+    *top    = min( *top, m_traces[i].colMinY );
+    *bottom = max( *bottom, m_traces[i].colMaxY );
+  }
+  if ( m_history == NULL )
+    return true;
+
+  for ( int i = 0; i < m_numTraces * m_historyStride; i++ )
+    if ( m_history[i] > HISTORY_SKIP )
+    {
+      *top    = min( *top, m_minY + m_history[i] );
+      *bottom = max( *bottom, m_minY + m_history[i] );
+    }
+  return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Range check of the auto-range mode for the values of addData(), newColumn if they start
+// a column
+void CGraph::autoRange( const float *vals, boolean newColumn )
+{
+  float y0 = axisDimensions.y0, yf = axisDimensions.yf;
+  float lo = vals[0], hi = vals[0];
+  float span, step, mag;
+  int   top, bottom;
+  boolean outside;
+
+  for ( byte i = 1; i < m_numTraces; i++ )
+  {
+    lo = min( lo, vals[i] );
+    hi = max( hi, vals[i] );
+  }
+  outside = ( hi > yf || lo < y0 );
+
+  if ( !outside && !( newColumn && m_history != NULL ) )
+    return;
+
+  if ( visibleRows( &top, &bottom ) )
+  {
+    // Rounding only makes the range higher, a curve using half of the plot stays
+    if ( !outside && ( bottom - top ) * 2 > m_dY )
+      return;
+
+    hi = max( hi, yf - (float)( top - m_minY ) / (float)( m_dY ) * ( yf - y0 ) );
+    lo = min( lo, yf - (float)( bottom - m_minY ) / (float)( m_dY ) * ( yf - y0 ) );
+  }
+
+  // Round limits, in steps of 1, 2 or 5 times a power of ten giving about four of them
+  span = max( hi - lo, m_autoMinSpan );
+  if ( span <= 0.0f )
+    span = ( hi != 0.0f ) ? fabs( hi ) : 1.0f;
+
+  mag  = pow( 10.0f, floor( log10( span / 4.0f ) ) );
+  step = span / 4.0f / mag;
+  step = mag * ( step <= 1.0f ? 1.0f : step <= 2.0f ? 2.0f : step <= 5.0f ? 5.0f : 10.0f );
+
+  lo = floor( lo / step ) * step;
+  hi = ceil( hi / step ) * step;
+  while ( hi - lo < m_autoMinSpan || hi <= lo )
+  {
+    hi += step;
+    if ( hi - lo < m_autoMinSpan )
+      lo -= step;
+  }
+
+  if ( !outside && ( hi - lo ) * 2.0f > yf - y0 )
+    return;
+
+  if ( m_YGridInterval != 0.0f )
+    m_YGridInterval = step;
+  m_rescales++;
+  setYRange( lo, hi );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+int CGraph::addTrace( byte r, byte g, byte b )
+{
+  return addTrace( RGB565( r, g, b ) );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Adds a curve in color to the graph, addData() then takes one value per trace. The traces
+// share one eraser, grid and cursor, so a column costs one background and grid pass however
+// many curves it shows. Returns the number of the trace, the first one is 0 and drawn in
+// the line color, or -1 if GRAPH_TRACES are used. Traces are added before the first
+// addData(); a history buffer is divided among them again.
+int CGraph::addTrace( word color )
+{
+  trace *tr;
+
+  if ( m_numTraces >= GRAPH_TRACES )
+    return -1;
+
+  tr = &m_traces[m_numTraces];
+  memset( tr, 0, sizeof(trace) );
+  tr->color     = color;
+  tr->oldY      = tr->segStartY = -1;
+  tr->updSpanY1 = 1;
+  m_numTraces++;
+
+  if ( m_history != NULL )
+    setHistoryBuffer( m_history, m_historySize );
+  return m_numTraces - 1;
+}
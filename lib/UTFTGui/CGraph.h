@@ -3,21 +3,40 @@
 
 #include <Arduino.h>
 #include <UTFT.h>
+#include "COverlay.h"
+#include "CDirtyRects.h"
+
+// Samples of the history as int16_t, for plot areas higher than about 120 pixels
+//#define GRAPH_HISTORY_16BIT
+
+#ifdef GRAPH_HISTORY_16BIT
+  typedef int16_t graphSample;
+  #define GRAPH_SAMPLE_MIN  INT16_MIN
+  #define GRAPH_SAMPLE_MAX  INT16_MAX
+#else
+  typedef int8_t  graphSample;
+  #define GRAPH_SAMPLE_MIN  INT8_MIN
+  #define GRAPH_SAMPLE_MAX  INT8_MAX
+#endif
+
+// Traces per graph, each costs 24 bytes in every graph
+#ifndef GRAPH_TRACES
+  #define GRAPH_TRACES      2
+#endif
+
+// Grid lines kept per axis, each costs 4 bytes in every graph. Lines past it are not drawn.
+#ifndef GRAPH_GRID_LINES
+  #define GRAPH_GRID_LINES  12
+#endif
 
 class CGraph
 {
   private:
   
-    typedef struct rgbcolor_tag{
-      byte r;
-      byte g;
-      byte b;
-    } rgbcolor;
-    
-    rgbcolor axisColor;
-    rgbcolor axisBackgroundColor;
-    rgbcolor lineColor;
-    rgbcolor gridColor;
+    // RGB565, packed once when set
+    word axisColor;
+    word axisBackgroundColor;
+    word gridColor;
     
     struct {
       int x, y;
@@ -27,8 +46,28 @@ class CGraph
     } axisDimensions;
     
     int m_eraserWidth;   //!< Eraser width in pixels
-    int m_oldCursorX, m_oldCursorY;
-    float m_oldValX;
+    int m_oldCursorX;
+    int m_segStartX;     // Start of the curve segments ending at the old cursor
+
+    // The curves, see addTrace(). All share the x-axis, the y-axis, the eraser and the grid.
+    struct trace {
+      word color;
+      int  oldY;                          // Row at the old cursor the curve goes on from
+      int  segStartY;
+      int  colMinY, colMaxY, colLastY;    // Envelope of the samples in the column of the old cursor
+
+      // Rows of the last update, drawn by drawArea(): the segment ending at the first
+      // sample of the old column, the span of that column if spanY1 <= spanY2, and the
+      // segment from its last sample to the new cursor, through endY on a new sweep
+      int  updStartY, updEntryY, updLastY, updEndY;
+      int  updSpanY1, updSpanY2;
+    };
+    trace m_traces[GRAPH_TRACES];
+    byte  m_numTraces;
+
+    // Columns of the last update
+    int     m_updStartX, m_updOldX;   // m_updOldX is -1 on the first sample
+    boolean m_updWrap;
     
     // Variables providing max/min drawable pixel coordinates for curves
     int m_maxX, m_maxY, m_minX, m_minY;
@@ -40,12 +79,71 @@ class CGraph
     float m_XGridInterval;
     float m_YGridInterval;
     float m_YGridStart;     // Pre-calculated first line of Y grid
+
+    // Columns of the x grid lines and rows of the y grid lines, both ascending, see updateGrid()
+    int  m_gridCols[GRAPH_GRID_LINES];
+    int  m_gridRows[GRAPH_GRID_LINES];
+    byte m_numGridCols, m_numGridRows;
+    void updateGrid();
+    byte gridFlags( boolean x, int p, byte *i );
     
+    int  sweepEndY( int oldY, int cursorX, int cursorY );
+    void drawTrace( int x1, int y1, int x2, int y2 );
     void drawAALine( int x1, int y1, int x2, int y2 );
-    void drawAAPixel( int x1, int y1, int colorGrad );
+    void drawAAPixel( int x1, int y1, word color );
+
+    // Off-screen band, see setBandBuffer()
+    word *m_band;
+    int   m_bandSize;
+
+    void addDataColumns( int cursorX, const int *cursorY );
+    int  updateSegments( const trace *tr, int *segments );
+    void updateColumns( int xa, int xb, int cursorX );
+    void drawColumns( int xa, int ya, int xb, int yb, int cursorX );
+    void drawArea( int x1, int y1, int x2, int y2, int cursorX );
+    void drawGridArea( int x1, int y1, int x2, int y2 );
+
+    // Frame-level repaint, see setDirtyRects(). The columns changed by the last addData(),
+    // drawn by paintLayer() from the segments and cursor of that update.
+    CDirtyRects  *m_dirty;
+    unsigned long m_dirtyFrame;     // Frame of the manager the update is painted in
+    boolean       m_transparent;
+    struct {
+      int x1, x2;
+    }             m_pendColumns[2];
+    byte          m_numPendColumns;
+    int           m_pendCursor;
+    static void paintLayer( void *graph, int x1, int y1, int x2, int y2 );
+
+    // Sample history, see setHistoryBuffer(). One sample per plot column in pixels below
+    // m_minY, the last one of the column, the sweep cursor is the write position of the
+    // ring. With m_historyEntries the row the segment into the column ended at follows, with
+    // m_historySpans the envelope of each column after that, its lowest and its highest row.
+    // The traces follow each other m_historyStride samples apart.
+    graphSample *m_history;
+    int          m_historySize;
+    int          m_historyStride;
+    boolean      m_historyEntries;
+    boolean      m_historySpans;
+    void recordHistory( graphSample *h, const trace *tr, int cursorX, int cursorY );
+    void setSample( graphSample *h, int i, graphSample y );
+    void cutHistory( graphSample *h, int i );
+    void clearColumns( graphSample *h, int a, int b );
+    void drawHistory( const graphSample *h, word color );
+
+    // Auto-range mode, see setAutoRange()
+    boolean      m_autoRange;
+    float        m_autoMinSpan;
+    unsigned int m_rescales;
+    boolean visibleRows( int *top, int *bottom );
+    void autoRange( const float *vals, boolean newColumn );
 
     boolean m_drawCursor;
     uint8_t m_numDraw;
+
+    // Cursor without band buffer, the plot area under it is drawn again by drawUnder()
+    COverlay m_cursor;
+    static void drawUnder( void *graph, int x1, int y1, int x2, int y2 );
     
     UTFT *m_tft;
     
@@ -59,14 +157,28 @@ class CGraph
     void setBackgroundColor( byte r, byte g, byte b );
     void setLineColor( byte r, byte g, byte b );
     void setGridColor( byte r, byte g, byte b );
+    void setAxisColor( word color ) { this->axisColor = color; };
+    void setBackgroundColor( word color ) { this->axisBackgroundColor = color; };
+    void setLineColor( word color ) { m_traces[0].color = color; };
+    void setGridColor( word color ) { this->gridColor = color; };
     void setXGridInterval( float ival );
     void setYGridInterval( float ival );
     void setEraserPixelWidth( int ival );
-    void setCursor( boolean bEnable ) { this->m_drawCursor = bEnable; };
+    void setCursor( boolean bEnable );
+    void setBandBuffer( word *buffer, int size );
+    void setDirtyRects( CDirtyRects *dirty );
+    void setTransparent( boolean bEnable );
+    void setHistoryBuffer( graphSample *buffer, int size );
+    void setYRange( float y0, float yf );
+    void setAutoRange( boolean bEnable, float minSpan = 0.0f );
+    int  addTrace( byte r, byte g, byte b );
+    int  addTrace( word color );
+    unsigned int getRescales() { return m_rescales; };   //!< Range changes of the auto-range mode
     
-    void addData( float t, float val );
+    void addData( float t, const float *vals );      //!< One value per trace
+    void addData( float t, float val ) { if ( m_numTraces == 1 ) addData( t, &val ); };   //!< Graphs with one trace, ignored with more
     
-    void redrawAxis();    //!< Redraws the axes and clears the current plot curve
+    void redrawAxis();    //!< Redraws the axes, and the curve if there is a history
 };
 
 #endif
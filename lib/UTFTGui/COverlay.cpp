@@ -0,0 +1,134 @@
+#include "COverlay.h"
+#include <UTFT.h>
+
+//---------------------------------------------------------------------------------------------------
+
+COverlay::COverlay( UTFT *tft, drawUnderFunc drawUnder, void *owner )
+{
+  m_tft       = tft;
+  m_drawUnder = drawUnder;
+  m_owner     = owner;
+
+  m_numRects = 0;
+  m_visible  = false;
+  m_saved    = false;
+
+  m_buffer     = NULL;
+  m_bufferSize = 0;
+
+  setColor( 255, 255, 255 );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void COverlay::setColor( byte r, byte g, byte b )
+{
+  this->m_color = RGB565( r, g, b );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// buffer holds size RGB565 pixels, enough for the area of the overlay: w*h for a
+// rectangle, w+h for a crosshair. Larger overlays are drawn again by the owner instead.
+void COverlay::setBuffer( word *buffer, int size )
+{
+  hide();
+  m_buffer     = ( size > 0 ) ? buffer : NULL;
+  m_bufferSize = size;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Moves the overlay to the rectangle x1,y1-x2,y2, e.g. a one pixel wide cursor line
+void COverlay::showRect( int x1, int y1, int x2, int y2 )
+{
+  hide();
+
+  m_rects[0].x1 = min( x1, x2 );
+  m_rects[0].y1 = min( y1, y2 );
+  m_rects[0].x2 = max( x1, x2 );
+  m_rects[0].y2 = max( y1, y2 );
+  m_numRects = 1;
+
+  show();
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Moves the crosshair to x,y, its lines span the area x1,y1-x2,y2
+void COverlay::showCross( int x, int y, int x1, int y1, int x2, int y2 )
+{
+  hide();
+
+  m_rects[0].x1 = min( x1, x2 );
+  m_rects[0].x2 = max( x1, x2 );
+  m_rects[0].y1 = m_rects[0].y2 = y;
+  m_rects[1].y1 = min( y1, y2 );
+  m_rects[1].y2 = max( y1, y2 );
+  m_rects[1].x1 = m_rects[1].x2 = x;
+  m_numRects = 2;
+
+  show();
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void COverlay::show()
+{
+  long area = 0;
+
+  for ( uint8_t i = 0; i < m_numRects; i++ )
+    area += long( m_rects[i].x2 - m_rects[i].x1 + 1 ) * ( m_rects[i].y2 - m_rects[i].y1 + 1 );
+
+  // Save the pixels under the overlay before it is drawn
+  m_saved = ( m_buffer != NULL && area <= m_bufferSize );
+  if ( m_saved )
+  {
+    word *p = m_buffer;
+
+    for ( uint8_t i = 0; i < m_numRects; i++ )
+    {
+      m_tft->beginBand( m_rects[i].x1, m_rects[i].y1, m_rects[i].x2, m_rects[i].y2, p );
+      m_drawUnder( m_owner, m_rects[i].x1, m_rects[i].y1, m_rects[i].x2, m_rects[i].y2 );
+      m_tft->endBand( false );
+      p += ( m_rects[i].x2 - m_rects[i].x1 + 1 ) * ( m_rects[i].y2 - m_rects[i].y1 + 1 );
+    }
+  }
+
+  m_tft->setColor( m_color );
+  for ( uint8_t i = 0; i < m_numRects; i++ )
+    m_tft->fillRect( m_rects[i].x1, m_rects[i].y1, m_rects[i].x2, m_rects[i].y2 );
+
+  m_visible = true;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void COverlay::hide()
+{
+  word *p = m_buffer;
+
+  if ( !m_visible ) return;
+
+  for ( uint8_t i = 0; i < m_numRects; i++ )
+  {
+    if ( m_saved )
+    {
+      // The band still holds the saved pixels, ending it sends them
+      m_tft->beginBand( m_rects[i].x1, m_rects[i].y1, m_rects[i].x2, m_rects[i].y2, p );
+      m_tft->endBand();
+      p += ( m_rects[i].x2 - m_rects[i].x1 + 1 ) * ( m_rects[i].y2 - m_rects[i].y1 + 1 );
+    }
+    else
+      m_drawUnder( m_owner, m_rects[i].x1, m_rects[i].y1, m_rects[i].x2, m_rects[i].y2 );
+  }
+
+  m_visible = false;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void COverlay::discard()
+{
+  m_visible = false;
+}
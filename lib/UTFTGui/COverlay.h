@@ -0,0 +1,60 @@
+#ifndef COVERLAY_H
+#define COVERLAY_H
+
+#include <Arduino.h>
+#include <UTFT.h>
+
+// Save-under overlay for cursors, markers and crosshairs: one filled rectangle or the two
+// lines of a crosshair, moved without repainting the area below it.
+//
+// The displays can not be read back, so the owner of the area draws what is under the
+// overlay again when asked to. With a buffer this happens off-screen through
+// UTFT::beginBand() when the overlay is shown, and hiding it sends the saved pixels in
+// one window per rectangle. Without a buffer the owner draws straight to the display
+// when the overlay is hidden. Either way a move costs the pixels of the old and the new
+// overlay only.
+class COverlay
+{
+  public:
+
+    // Draws the content of the owner's area inside x1,y1-x2,y2
+    typedef void (*drawUnderFunc)( void *owner, int x1, int y1, int x2, int y2 );
+
+  private:
+
+    struct {
+      int x1, y1, x2, y2;
+    } m_rects[2];
+    uint8_t m_numRects;
+
+    boolean m_visible;
+    boolean m_saved;      // Buffer holds the pixels under the overlay
+
+    word  m_color;        // RGB565
+    word *m_buffer;
+    int   m_bufferSize;
+
+    drawUnderFunc m_drawUnder;
+    void *m_owner;
+
+    UTFT *m_tft;
+
+    void show();
+
+  public:
+
+    COverlay( UTFT *tft, drawUnderFunc drawUnder, void *owner );
+    ~COverlay() {};
+
+    void setColor( byte r, byte g, byte b );
+    void setColor( word color ) { this->m_color = color; };
+    void setBuffer( word *buffer, int size );
+
+    void showRect( int x1, int y1, int x2, int y2 );
+    void showCross( int x, int y, int x1, int y1, int x2, int y2 );
+    void hide();
+    void discard();       //!< Forgets the overlay after its area was repainted
+    boolean isVisible() { return m_visible; };
+};
+
+#endif
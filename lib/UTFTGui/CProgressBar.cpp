@@ -12,23 +12,16 @@ CProgressBar::CProgressBar( int x, int y, int w, int h, float x0, float xf, UTFT
   barDimensions.x0 = x0;
   barDimensions.xf = xf;
   
-  frameColor.r = 0xFF;
-  frameColor.g = 0xFF;
-  frameColor.b = 0xFF;
+  frameColor = RGB565( 0xFF, 0xFF, 0xFF );
   
-  backgroundColor.r = 0;
-  backgroundColor.g = 0;
-  backgroundColor.b = 0;
+  backgroundColor = RGB565( 0, 0, 0 );
   
-  barColor.r = 0;
-  barColor.g = 0xEF;
-  barColor.b = 0;
+  barColor = RGB565( 0, 0xEF, 0 );
   
-  barAlert.r = 0xEF;
-  barAlert.g = 0;
-  barAlert.b = 0;
+  barAlert = RGB565( 0xEF, 0, 0 );
   
-  m_tft = tft;
+  m_tft   = tft;
+  m_dirty = NULL;
   
   setMargin(1);
   
@@ -95,6 +88,18 @@ void CProgressBar::update(float val)
   
   if( cursorX == m_oldXVal ) return; // Nothing to do
   
+  // Only the columns between the old and the new value change, paintLayer() draws them
+  if( m_dirty != NULL )
+  {
+    if( m_baseX >= 0 )
+      cursorX = max( cursorX, m_minX );
+    
+    m_dirty->invalidate( min( cursorX, m_oldXVal ), m_minY, max( cursorX, m_oldXVal ), m_maxY );
+    m_oldVal  = val;
+    m_oldXVal = cursorX;
+    return;
+  }
+  
   if( m_baseX >= 0 )
   {
     cursorX = max( cursorX, m_minX );
@@ -105,19 +110,19 @@ void CProgressBar::update(float val)
       {
         if( m_oldXVal > m_baseX )
         {
-          m_tft->setColor( backgroundColor.r, backgroundColor.g, backgroundColor.b );
+          m_tft->setColor( backgroundColor );
           m_tft->fillRect( m_baseX+1, m_minY, m_oldXVal, m_maxY );
         }
         
         if( cursorX < m_baseX )
         {
-          m_tft->setColor( barColor.r, barColor.g, barColor.b );
+          m_tft->setColor( barColor );
           m_tft->fillRect( min(m_baseX-1, m_oldXVal-1), m_minY, cursorX, m_maxY );
         }
       }
       else
       {
-        m_tft->setColor( backgroundColor.r, backgroundColor.g, backgroundColor.b );
+        m_tft->setColor( backgroundColor );
         m_tft->fillRect( cursorX+1, m_minY, m_oldXVal, m_maxY );
       }
     }
@@ -127,19 +132,19 @@ void CProgressBar::update(float val)
       {
         if( m_oldXVal < m_baseX )
         {
-          m_tft->setColor( backgroundColor.r, backgroundColor.g, backgroundColor.b );
+          m_tft->setColor( backgroundColor );
           m_tft->fillRect( m_baseX-1, m_minY, m_oldXVal, m_maxY );
         }
         
         if( cursorX > m_baseX )
         {
-          m_tft->setColor( barColor.r, barColor.g, barColor.b );
+          m_tft->setColor( barColor );
           m_tft->fillRect( max(m_baseX+1, m_oldXVal+1), m_minY, cursorX, m_maxY );
         }
       }
       else
       {
-        m_tft->setColor( backgroundColor.r, backgroundColor.g, backgroundColor.b );
+        m_tft->setColor( backgroundColor );
         m_tft->fillRect( cursorX-1, m_minY, m_oldXVal, m_maxY );
       }
     }
@@ -150,7 +155,7 @@ void CProgressBar::update(float val)
     {
       if( m_oldXVal < m_minX ) return; // Nothing to do
       
-      m_tft->setColor( backgroundColor.r, backgroundColor.g, backgroundColor.b );
+      m_tft->setColor( backgroundColor );
       m_tft->fillRect( cursorX+1, m_minY, m_oldXVal, m_maxY );
     }
     else
@@ -158,13 +163,13 @@ void CProgressBar::update(float val)
       // Draw new part of progressbar
       if( m_oldXVal < m_maxAlertX-1 )
       {
-        m_tft->setColor( barColor.r, barColor.g, barColor.b );
+        m_tft->setColor( barColor );
         m_tft->fillRect( m_oldXVal+1, m_minY, min(cursorX, m_maxAlertX-1), m_maxY );
       }
       
       if( cursorX >= m_maxAlertX )
       {
-        m_tft->setColor( barAlert.r, barAlert.g, barAlert.b );
+        m_tft->setColor( barAlert );
         m_tft->fillRect( max(m_oldXVal+1,m_maxAlertX), m_minY, cursorX, m_maxY );
       }      
     }
@@ -179,22 +184,71 @@ void CProgressBar::update(float val)
 void CProgressBar::redraw(void)
 {
   // Draw frame & margin
-  m_tft->setColor( frameColor.r, frameColor.g, frameColor.b );
+  m_tft->setColor( frameColor );
   m_tft->drawRect( barDimensions.x, barDimensions.y, barDimensions.x + barDimensions.w - 1, barDimensions.y + barDimensions.h - 1 );
   
-  m_tft->setColor( backgroundColor.r, backgroundColor.g, backgroundColor.b );
+  m_tft->setColor( backgroundColor );
   m_tft->fillRect( m_minX, m_minY, m_maxX, m_maxY );
   
   // Draw cursor
   if( m_baseX >= -1 )
   {
-    m_tft->setColor( frameColor.r, frameColor.g, frameColor.b );
+    m_tft->setColor( frameColor );
     m_tft->drawLine( m_baseX, m_minY, m_baseX, m_maxY );
   }
 }
 
 //---------------------------------------------------------------------------------------------------
 
+// Registers the bar as a layer of dirty, after setMargin(). update() then only marks the
+// changed columns and dirty->paint() draws them from the current value.
+void CProgressBar::setDirtyRects( CDirtyRects *dirty )
+{
+  m_dirty = dirty;
+  if( dirty != NULL )
+    dirty->addLayer( m_minX, m_minY, m_maxX + 1, m_maxY, paintLayer, this );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// The inside of the bar within x1,y1-x2,y2, the same pixels as the incremental update()
+void CProgressBar::paintLayer( void *bar, int x1, int y1, int x2, int y2 )
+{
+  CProgressBar *b = (CProgressBar *)bar;
+  int cursorX = b->m_oldXVal;
+  
+  b->m_tft->setColor( b->backgroundColor );
+  b->m_tft->fillRect( x1, y1, x2, y2 );
+  
+  if( b->m_baseX >= 0 )
+  {
+    b->m_tft->setColor( b->barColor );
+    if( cursorX > b->m_baseX )
+      b->m_tft->fillRect( b->m_baseX+1, y1, cursorX, y2 );
+    else if( cursorX < b->m_baseX )
+      b->m_tft->fillRect( cursorX, y1, b->m_baseX-1, y2 );
+    
+    b->m_tft->setColor( b->frameColor );
+    b->m_tft->drawLine( b->m_baseX, y1, b->m_baseX, y2 );
+  }
+  else if( cursorX >= b->m_minX )
+  {
+    if( b->m_minX < b->m_maxAlertX )
+    {
+      b->m_tft->setColor( b->barColor );
+      b->m_tft->fillRect( b->m_minX, y1, min(cursorX, b->m_maxAlertX-1), y2 );
+    }
+    
+    if( cursorX >= b->m_maxAlertX )
+    {
+      b->m_tft->setColor( b->barAlert );
+      b->m_tft->fillRect( max(b->m_minX, b->m_maxAlertX), y1, cursorX, y2 );
+    }
+  }
+}
+
+//---------------------------------------------------------------------------------------------------
+
 void CProgressBar::setMargin( int m )
 { 
   m_margin = m; 
@@ -3,21 +3,17 @@
 
 #include <Arduino.h>
 #include <UTFT.h>
+#include "CDirtyRects.h"
 
 class CProgressBar
 {
   private:
   
-    typedef struct rgbcolor_tag{
-      byte r;
-      byte g;
-      byte b;
-    } rgbcolor;
-    
-    rgbcolor barColor;
-    rgbcolor barAlert;
-    rgbcolor backgroundColor;
-    rgbcolor frameColor;
+    // RGB565, packed once in the constructor
+    word barColor;
+    word barAlert;
+    word backgroundColor;
+    word frameColor;
 
     int m_margin;
     
@@ -35,6 +31,10 @@ class CProgressBar
     
     UTFT *m_tft;
     
+    // Frame-level repaint, see setDirtyRects()
+    CDirtyRects *m_dirty;
+    static void paintLayer( void *bar, int x1, int y1, int x2, int y2 );
+    
     struct {
       int x, y;
       int w, h;
@@ -54,6 +54,7 @@ class CProgressBar
       void setBaseValue( float xZ );
       void setMaxAlert( float xAlertMax );
       void setMinAlert( float xAlertMin );
+      void setDirtyRects( CDirtyRects *dirty );
             
       void update(float val);
       
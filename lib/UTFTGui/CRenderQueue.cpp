@@ -0,0 +1,265 @@
+#include "CRenderQueue.h"
+#include <UTFT.h>
+
+#define RQ_FILL   0
+#define RQ_TEXT   1
+
+//---------------------------------------------------------------------------------------------------
+
+CRenderQueue::CRenderQueue( UTFT *tft )
+{
+  m_tft  = tft;
+  m_head = 0;
+  m_tail = 0;
+  m_lock = 0;
+
+  m_font = NULL;
+  setColor( 255, 255, 255 );
+  setBackColor( 0, 0, 0 );
+
+  resetStats();
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CRenderQueue::setColor( byte r, byte g, byte b )
+{
+  this->m_color = RGB565( r, g, b );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CRenderQueue::setBackColor( byte r, byte g, byte b )
+{
+  this->m_back = RGB565( r, g, b );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CRenderQueue::resetStats()
+{
+  memset( &m_stats, 0, sizeof(m_stats) );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+byte CRenderQueue::getDepth()
+{
+  return ( m_head + RENDERQUEUE_SIZE - m_tail ) % RENDERQUEUE_SIZE;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// The next free command, NULL if the queue is full. Nothing is visible to drain() before commit().
+CRenderQueue::command *CRenderQueue::reserve( byte type )
+{
+  command *cmd;
+
+  if ( ( m_head + 1 ) % RENDERQUEUE_SIZE == m_tail )
+  {
+    m_stats.overflows++;
+    return NULL;
+  }
+
+  cmd        = &m_cmds[m_head];
+  cmd->type  = type;
+  cmd->color = m_color;
+  cmd->back  = m_back;
+  cmd->font  = m_font;
+  cmd->pos   = 0;
+  return cmd;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CRenderQueue::commit()
+{
+  byte depth;
+
+  m_cmds[m_head].time = micros();
+  m_head = ( m_head + 1 ) % RENDERQUEUE_SIZE;
+
+  m_stats.queued++;
+  depth = getDepth();
+  if ( depth > m_stats.maxDepth )
+    m_stats.maxDepth = depth;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+boolean CRenderQueue::fillRect( int x1, int y1, int x2, int y2 )
+{
+  command *cmd = reserve( RQ_FILL );
+
+  if ( cmd == NULL ) return false;
+
+  cmd->x1 = min( x1, x2 );
+  cmd->y1 = min( y1, y2 );
+  cmd->x2 = max( x1, x2 );
+  cmd->y2 = max( y1, y2 );
+  commit();
+  return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+boolean CRenderQueue::drawHLine( int x, int y, int l )
+{
+  return fillRect( x, y, x + l, y );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+boolean CRenderQueue::drawVLine( int x, int y, int l )
+{
+  return fillRect( x, y, x, y + l );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// x can be LEFT, RIGHT or CENTER like for UTFT::print()
+boolean CRenderQueue::print( const char *st, int x, int y )
+{
+  command *cmd = reserve( RQ_TEXT );
+
+  if ( cmd == NULL ) return false;
+
+  strncpy( cmd->text, st, RENDERQUEUE_TEXT );
+  cmd->text[RENDERQUEUE_TEXT] = 0;
+  cmd->x1 = x;
+  cmd->y1 = y;
+  commit();
+  return true;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+boolean CRenderQueue::printNumI( long num, int x, int y, int length, char filler )
+{
+  char st[27];
+
+  m_tft->_format_num_i( st, num, length, filler );
+  return print( st, x, y );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+boolean CRenderQueue::printNumF( double num, byte dec, int x, int y, char divider, int length, char filler )
+{
+  char st[27];
+
+  m_tft->_format_num_f( st, num, dec, divider, length, filler );
+  return print( st, x, y );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Draws whole rows of a fill or whole characters of a glyph run, at least one, until budget
+// pixels are drawn or the command is done. Returns the pixels drawn.
+long CRenderQueue::drawSlice( command *cmd, long budget )
+{
+  long drawn = 0;
+
+  m_tft->setColor( cmd->color );
+
+  if ( cmd->type == RQ_FILL )
+  {
+    long w    = cmd->x2 - cmd->x1 + 1;
+    int  rows = constrain( budget / w, 1L, (long)( cmd->y2 - cmd->y1 + 1 ) );
+
+    m_tft->fillRect( cmd->x1, cmd->y1, cmd->x2, cmd->y1 + rows - 1 );
+    cmd->y1 += rows;
+    return w * rows;
+  }
+
+  m_tft->setBackColor( cmd->back );
+  m_tft->setFont( cmd->font );
+
+  int cw = m_tft->getFontXsize();
+  int ch = m_tft->getFontYsize();
+
+  if ( cmd->pos == 0 && ( cmd->x1 == RIGHT || cmd->x1 == CENTER ) )
+  {
+    int len = strlen( cmd->text ) * cw;
+
+    cmd->x1 = ( cmd->x1 == RIGHT ) ? m_tft->getDisplayXSize() - len : ( m_tft->getDisplayXSize() - len ) / 2;
+  }
+
+  while ( cmd->text[cmd->pos] != 0 && ( drawn == 0 || drawn + cw * ch <= budget ) )
+  {
+    m_tft->printChar( cmd->text[cmd->pos++], cmd->x1, cmd->y1 );
+    cmd->x1 += cw;
+    drawn   += cw * ch;
+  }
+  return drawn;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+long CRenderQueue::drain( long budget )
+{
+  long drawn = 0;
+
+  if ( m_lock != 0 || m_head == m_tail ) return 0;
+  m_lock++;
+
+  // The state of UTFT belongs to the code that was interrupted
+  word     color   = m_tft->getColor();
+  word     back    = m_tft->getBackColor();
+  boolean  transp  = m_tft->_transparent;
+  uint8_t *font    = m_tft->getFont();
+
+  while ( m_head != m_tail && drawn < budget )
+  {
+    command *cmd = &m_cmds[m_tail];
+
+    drawn += drawSlice( cmd, budget - drawn );
+
+    if ( cmd->type == RQ_FILL ? cmd->y1 > cmd->y2 : cmd->text[cmd->pos] == 0 )
+    {
+      unsigned long latency = micros() - cmd->time;
+
+      m_stats.done++;
+      m_stats.sumLatency += latency;
+      if ( latency > m_stats.maxLatency )
+        m_stats.maxLatency = latency;
+      m_tail = ( m_tail + 1 ) % RENDERQUEUE_SIZE;
+    }
+  }
+  m_stats.slices++;
+
+  m_tft->setColor( color );
+  m_tft->setBackColor( back );
+  if ( transp )
+    m_tft->setBackColor( VGA_TRANSPARENT );
+  if ( font != NULL )
+    m_tft->setFont( font );
+
+  m_lock--;
+  return drawn;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Not between suspend() and resume(), nothing would be drawn
+void CRenderQueue::flush()
+{
+  while ( !isEmpty() )
+    if ( drain( 0x7FFFFFFFL ) == 0 )
+      break;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Keeps the timer from drawing while loop() draws to the same display. Calls can be nested.
+void CRenderQueue::suspend()
+{
+  m_lock++;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void CRenderQueue::resume()
+{
+  m_lock--;
+}
@@ -0,0 +1,102 @@
+#ifndef CRENDERQUEUE_H
+#define CRENDERQUEUE_H
+
+#include <Arduino.h>
+#include <UTFT.h>
+
+// Commands in the queue, one less can be queued at a time
+#ifndef RENDERQUEUE_SIZE
+  #define RENDERQUEUE_SIZE  16
+#endif
+
+// Characters per glyph run, longer text is cut
+#ifndef RENDERQUEUE_TEXT
+  #define RENDERQUEUE_TEXT  15
+#endif
+
+// Render commands queued by loop() and drawn from a timer interrupt, so a long redraw does
+// not hold up the sensor reads:
+//
+//   void drainDisplay() { renderQueue.drain( 128 ); }
+//   MsTimer2::set( 1, drainDisplay ); MsTimer2::start();
+//
+// Each drain() draws about budget pixels, whole rows of a fill or whole characters of a
+// glyph run. The queue has its own color, back color and font like UTFT and restores
+// those of UTFT after each slice. Everything else that draws to the same display has to
+// be put between suspend() and resume(), the timer then leaves the bus alone.
+class CRenderQueue
+{
+  public:
+
+    struct stats {
+      byte maxDepth;                // Commands queued at most
+      unsigned long queued;         // Commands accepted
+      unsigned long overflows;      // Commands dropped as the queue was full
+      unsigned long done;           // Commands completely drawn
+      unsigned long slices;         // drain() calls that drew something
+      unsigned long maxLatency;     // From queueing to the last pixel in us
+      unsigned long sumLatency;
+    };
+
+  private:
+
+    struct command {
+      byte     type;
+      word     color;
+      uint32_t back;                // Back color of glyph runs or VGA_TRANSPARENT
+      uint8_t *font;
+      int      x1, y1, x2, y2;      // Fill area, or position of the next character
+      char     text[RENDERQUEUE_TEXT + 1];
+      byte     pos;                 // Next character
+      unsigned long time;           // micros() when queued
+    };
+
+    command       m_cmds[RENDERQUEUE_SIZE];
+    volatile byte m_head;           // Written by loop()
+    volatile byte m_tail;           // Written by drain()
+    volatile byte m_lock;           // suspend() or drain() running
+
+    word     m_color;
+    uint32_t m_back;
+    uint8_t *m_font;
+
+    stats m_stats;
+
+    UTFT *m_tft;
+
+    command *reserve( byte type );
+    void     commit();
+    long     drawSlice( command *cmd, long budget );
+
+  public:
+
+    CRenderQueue( UTFT *tft );
+    ~CRenderQueue() {};
+
+    void setColor( byte r, byte g, byte b );
+    void setColor( word color ) { this->m_color = color; };
+    void setBackColor( byte r, byte g, byte b );
+    void setBackColor( uint32_t color ) { this->m_back = color; };
+    void setFont( uint8_t *font ) { this->m_font = font; };
+
+    // false if the queue is full
+    boolean fillRect( int x1, int y1, int x2, int y2 );
+    boolean drawHLine( int x, int y, int l );
+    boolean drawVLine( int x, int y, int l );
+    boolean print( const char *st, int x, int y );
+    boolean printNumI( long num, int x, int y, int length=0, char filler=' ' );
+    boolean printNumF( double num, byte dec, int x, int y, char divider='.', int length=0, char filler=' ' );
+
+    long drain( long budget );      //!< Draws about budget pixels, returns the pixels drawn
+    void flush();                   //!< Draws everything queued, from loop()
+    boolean isEmpty() { return m_head == m_tail; };
+    byte getDepth();                //!< Commands queued now
+
+    void suspend();
+    void resume();
+
+    const stats &getStats() { return m_stats; };
+    void resetStats();
+};
+
+#endif
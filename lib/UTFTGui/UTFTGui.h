@@ -3,8 +3,12 @@
 
 #include <Arduino.h>
 #include <UTFT.h>
+#include "COverlay.h"
+#include "CDirtyRects.h"
 #include "CGraph.h"
 #include "CProgressBar.h"
 #include "CTextDisplay.h"
+#include "CFrame.h"
+#include "CRenderQueue.h"
 
 #endif
\ No newline at end of file
@@ -7,24 +7,27 @@ uText::uText( UTFT* utftDev, uint16_t width, uint16_t height ) {
     utft = utftDev;
     deviceWidth = width;
     deviceHeight = height;
-    mr = 0xa0;
-    mg = 0xa0;
-    mb = 0xa0;
-    cr = 0xff;
-    cg = 0xff;
-    cb = 0xff;
+    matte = RGB565(0xa0, 0xa0, 0xa0);
+    fg = RGB565(0xff, 0xff, 0xff);
+    blendValid = false;
 }
 
 void uText::setBackground(uint8_t r, uint8_t g, uint8_t b) {
-    mr = r;
-    mg = g;
-    mb = b;
+    setBackground(RGB565(r, g, b));
 }
 
 void uText::setForeground(uint8_t r, uint8_t g, uint8_t b) {
-    cr = r;
-    cg = g;
-    cb = b;
+    setForeground(RGB565(r, g, b));
+}
+
+void uText::setBackground(uint16_t color) {
+    matte = color;
+    blendValid = false;
+}
+
+void uText::setForeground(uint16_t color) {
+    fg = color;
+    blendValid = false;
 }
 
 int uText::setFont(prog_uchar font[]) {
@@ -67,6 +70,12 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
         return;
     }
 
+    // Antialiased pixels look their color up, the table is built once per color change
+    if ( fontType == ANTIALIASED_FONT && !blendValid ) {
+        utft->makeBlendTable(blend, OPACITY_LEVELS, fg, matte);
+        blendValid = true;
+    }
+
     int kernPtr = 0;
     int kern = -100; // no kerning
 
@@ -123,9 +132,9 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
                                 ctr += len;
                                 if ( (0x80 & b) > 0 ) {
                                 	if ( clean > 0 ) {
-                                    	utft->setColor(mr, mg, mb);
+                                    	utft->setColor(matte);
                                     } else {
-                                    	utft->setColor(cr, cg, cb);
+                                    	utft->setColor(fg);
                                     }
                                     while ( y + len > effHeight ) {
                                         utft->drawLine(x1 + marginLeft + x, yy + marginTop + y, x1 + marginLeft + x, yy + marginTop + effHeight);
@@ -137,13 +146,9 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
                                 }
                             } else {
                                 if ( clean > 0 ) {
-                                   	utft->setColor(mr, mg, mb);
+                                   	utft->setColor(matte);
 								} else {
-	                                int opacity = (0xff & (b * 4));
-	                                int sr = (cr * (255 - opacity) + mr * (opacity))/255;
-	                                int sg = (cg * (255 - opacity) + mg * (opacity))/255;
-	                                int sb = (cb * (255 - opacity) + mb * (opacity))/255;
-									utft->setColor(sr, sg, sb);
+									utft->setColor(blend[b]);
 								}
                                 utft->drawPixel(x1 + marginLeft + x, yy + marginTop + y);
                                 ctr++;
@@ -162,9 +167,9 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
                                 ctr += len;
                                 if ( (0x80 & b) > 0 ) {
 	                                if ( clean > 0 ) {
-    	                               	utft->setColor(mr, mg, mb);
+    	                               	utft->setColor(matte);
 									} else {
-            	                        utft->setColor(cr, cg, cb);
+            	                        utft->setColor(fg);
             	                        }
                                     while ( x + len > effWidth ) {
                                         utft->drawLine(x1 + marginLeft + x - 1, yy + marginTop + y, x1 + marginLeft + effWidth - 1, yy + marginTop + y);
@@ -176,13 +181,9 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
                                 }
                             } else {
                                 if ( clean > 0 ) {
-                                   	utft->setColor(mr, mg, mb);
+                                   	utft->setColor(matte);
 								} else {
-	                                int opacity = (0xff & (b * 4));
-	                                int sr = (cr * (255 - opacity) + mr * (opacity))/255;
-	                                int sg = (cg * (255 - opacity) + mg * (opacity))/255;
-	                                int sb = (cb * (255 - opacity) + mb * (opacity))/255;
-	                                utft->setColor(sr, sg, sb);
+	                                utft->setColor(blend[b]);
 	                            }
                                 utft->drawPixel(x1 + marginLeft + x, yy + marginTop + y);
                                 ctr++;
@@ -193,9 +194,9 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
                 } else if ( fontType == BITMASK_FONT ) {
 
                     if ( clean > 0 ) {
-						utft->setColor(mr, mg, mb);
+						utft->setColor(matte);
 					} else {
-						utft->setColor( (int)cr, (int)cg, (int)cb );
+						utft->setColor(fg);
 					}
 
                     boolean compressed = (pgm_read_byte_near(currentFont + ptr + 7) & 0x80) > 0;
@@ -279,7 +280,7 @@ void uText::printString(int16_t xx, int16_t yy, String text, int clean, int8_t k
         }
     }
 
-    utft->setColor( cr, cg, cb );
+    utft->setColor(fg);
 }
 
 int16_t uText::getLineHeight() {
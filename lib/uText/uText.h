@@ -31,6 +31,7 @@
 #define BITMASK_FONT 1
 #define ANTIALIASED_FONT 2
 #define HEADER_LENGTH 5
+#define OPACITY_LEVELS 64
 
 class uText
 {
@@ -42,14 +43,12 @@ private:
         uint16_t deviceHeight;
         /* currently selected font */
         prog_uchar* currentFont;
-        /* character color */
-        uint8_t cr;
-        uint8_t cg;
-        uint8_t cb;
-        /* matte color */
-        uint8_t mr;
-        uint8_t mg;
-        uint8_t mb;
+        /* character and matte color, RGB565 */
+        uint16_t fg;
+        uint16_t matte;
+        /* antialiased pixels, fg at opacity 0 to matte at OPACITY_LEVELS - 1 */
+        uint16_t blend[OPACITY_LEVELS];
+        boolean blendValid;
 
         void printString(int16_t xx, int16_t yy, String text, int clean, int8_t kerning[] = NULL);
 
@@ -59,6 +58,8 @@ public:
         int setFont(prog_uchar font[]);
         void setBackground(uint8_t r, uint8_t g, uint8_t b);
         void setForeground(uint8_t r, uint8_t g, uint8_t b);
+        void setBackground(uint16_t color);
+        void setForeground(uint16_t color);
         void print(int16_t xx, int16_t yy, String text, int8_t kerning[] = NULL);
         void clean(int16_t xx, int16_t yy, String text, int8_t kerning[] = NULL);
         int16_t getLineHeight();
@@ -0,0 +1,104 @@
+#include "Arduino.h"
+
+volatile uint8_t hostPorts[256];
+
+HardwareSerial Serial;
+
+static unsigned long s_millis = 0;
+
+//---------------------------------------------------------------------------------------------------
+
+void pinMode( uint8_t pin, uint8_t mode )
+{
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void digitalWrite( uint8_t pin, uint8_t val )
+{
+  if ( val == LOW )
+    hostPorts[pin] &= ~1;
+  else
+    hostPorts[pin] |= 1;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+int digitalRead( uint8_t pin )
+{
+  return hostPorts[pin] & 1;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+int analogRead( uint8_t pin )
+{
+  return 0;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+unsigned long millis()
+{
+  return s_millis;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+unsigned long micros()
+{
+  return s_millis * 1000UL;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void delay( unsigned long ms )
+{
+  s_millis += ms;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void delayMicroseconds( unsigned int us )
+{
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void hostAdvanceMillis( unsigned long ms )
+{
+  s_millis += ms;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+long random( long howbig )
+{
+  if ( howbig == 0 ) return 0;
+  return rand() % howbig;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+long random( long howsmall, long howbig )
+{
+  if ( howsmall >= howbig ) return howsmall;
+  return random( howbig - howsmall ) + howsmall;
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void randomSeed( unsigned long seed )
+{
+  srand( seed );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+void String::toCharArray( char *buf, unsigned int bufsize ) const
+{
+  if ( bufsize == 0 ) return;
+
+  strncpy( buf, m_str.c_str(), bufsize - 1 );
+  buf[bufsize - 1] = 0;
+}
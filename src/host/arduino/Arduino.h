@@ -0,0 +1,111 @@
+/*
+ * Minimal Arduino core for the host simulation build (env:native)
+ * ===============================================================
+ *
+ * Provides just enough of the Arduino API to compile UTFT, UTFTGui and
+ * uText on a PC. Pins are backed by one fake port register each, time is
+ * a counter that only moves on delay() or hostAdvanceMillis().
+ *
+ * Note: UTFT's hardware defines add a function-like swap() macro, so any
+ * C++ standard header has to be included before UTFT.h.
+ */
+#ifndef Arduino_h
+#define Arduino_h
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <string>
+#include <type_traits>
+
+#include "avr/pgmspace.h"
+
+typedef uint8_t  byte;
+typedef uint16_t word;
+typedef bool     boolean;
+
+#define HIGH   0x1
+#define LOW    0x0
+
+#define INPUT  0x0
+#define OUTPUT 0x1
+
+#ifndef M_PI
+  #define M_PI 3.14159265358979323846
+#endif
+
+template<class T, class U> inline typename std::common_type<T, U>::type min( T a, U b ) { return ( b < a ) ? b : a; }
+template<class T, class U> inline typename std::common_type<T, U>::type max( T a, U b ) { return ( a < b ) ? b : a; }
+template<class T, class L, class H> inline T constrain( T x, L lo, H hi ) { return x < lo ? lo : ( x > hi ? hi : x ); }
+
+inline long map( long x, long in_min, long in_max, long out_min, long out_max )
+{
+  return ( x - in_min ) * ( out_max - out_min ) / ( in_max - in_min ) + out_min;
+}
+
+// Every pin gets a port register of its own with bit 0 as the pin
+extern volatile uint8_t hostPorts[256];
+
+#define digitalPinToPort(P)     ( (uint8_t)(P) )
+#define digitalPinToBitMask(P)  ( (uint8_t)1 )
+#define portOutputRegister(P)   ( &hostPorts[(P)] )
+
+void pinMode( uint8_t pin, uint8_t mode );
+void digitalWrite( uint8_t pin, uint8_t val );
+int  digitalRead( uint8_t pin );
+int  analogRead( uint8_t pin );
+
+unsigned long millis();
+unsigned long micros();
+void delay( unsigned long ms );
+void delayMicroseconds( unsigned int us );
+void hostAdvanceMillis( unsigned long ms );
+
+long random( long howbig );
+long random( long howsmall, long howbig );
+void randomSeed( unsigned long seed );
+
+class String
+{
+  private:
+
+    std::string m_str;
+
+  public:
+
+    String() {};
+    String( const char *str ) : m_str( str ? str : "" ) {};
+    String( const std::string &str ) : m_str( str ) {};
+    ~String() {};
+
+    unsigned int length() const { return m_str.length(); };
+    char charAt( unsigned int index ) const { return index < m_str.length() ? m_str[index] : 0; };
+    const char *c_str() const { return m_str.c_str(); };
+    void toCharArray( char *buf, unsigned int bufsize ) const;
+
+    String operator+( const String &rhs ) const { return String( m_str + rhs.m_str ); };
+    bool operator==( const String &rhs ) const { return m_str == rhs.m_str; };
+    bool operator!=( const String &rhs ) const { return m_str != rhs.m_str; };
+};
+
+class HardwareSerial
+{
+  public:
+
+    void begin( unsigned long baud ) {};
+    void print( const char *str )     { fputs( str, stdout ); };
+    void print( const String &str )   { fputs( str.c_str(), stdout ); };
+    void print( char c )              { fputc( c, stdout ); };
+    void print( long n )              { printf( "%ld", n ); };
+    void print( int n )               { printf( "%d", n ); };
+    void print( unsigned long n )     { printf( "%lu", n ); };
+    void print( double n, int d = 2 ) { printf( "%.*f", d, n ); };
+    void println()                    { fputc( '\n', stdout ); };
+    template<class T> void println( T val ) { print( val ); println(); };
+};
+
+extern HardwareSerial Serial;
+
+#endif
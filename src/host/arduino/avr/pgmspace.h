@@ -0,0 +1,20 @@
+// Host stand-in for <avr/pgmspace.h>. Flash and RAM share one address
+// space on the host, so the PROGMEM accessors are plain reads.
+
+#ifndef __PGMSPACE_H_
+#define __PGMSPACE_H_
+
+#include <stdint.h>
+
+#define PROGMEM
+#define PSTR(s) (s)
+
+#define pgm_read_byte(addr)			(*(const uint8_t *)(addr))
+#define pgm_read_word(addr)			(*(const uint16_t *)(addr))
+#define pgm_read_dword(addr)		(*(const uint32_t *)(addr))
+#define pgm_read_byte_near(addr)	pgm_read_byte(addr)
+#define pgm_read_word_near(addr)	pgm_read_word(addr)
+#define pgm_read_byte_far(addr)		pgm_read_byte(addr)
+#define pgm_read_word_far(addr)		pgm_read_word(addr)
+
+#endif
@@ -0,0 +1,9 @@
+// Host stand-in for <pins_arduino.h>. The pin mapping macros live in
+// Arduino.h of the host core.
+
+#ifndef Pins_Arduino_h
+#define Pins_Arduino_h
+
+#include "Arduino.h"
+
+#endif
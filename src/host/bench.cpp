@@ -0,0 +1,1514 @@
+/*
+ * Host benchmark for the display code
+ * ===================================
+ *
+ * Runs the real UTFT, UTFTGui and uText code against the simulated
+ * controller (lib/UTFT/hardware/sim) and prints the bus traffic of each
+ * scenario together with a checksum of the resulting image.
+ *
+ * Build and run:  pio run -e native && .pio/build/native/program [outdir]
+ *
+ * If an output directory is given, the final image of every scenario is
+ * written to <outdir>/<scenario>.ppm for visual inspection or image diffs.
+ */
+#include <chrono>
+#include <Arduino.h>
+#include <UTFT.h>
+#include <UTFT_Static.h>
+#include <UTFTGui.h>
+#include "uText.h"
+
+extern uint8_t SmallFont[];
+extern uint8_t BigFont[];
+extern uint8_t SevenSegNumFont[];
+extern uint8_t LucidaConsole10a[];
+extern const unsigned char bmDial[], bmDialLandscape[], bmIcon[], bmIcon16[], bmMono[], bmBar[];
+
+UTFT myGLCD(ITDB32S,38,39,40,41);
+UTFT_Static<ITDB32S> myStaticGLCD(38,39,40,41);
+UTFT mySerialGLCD(ILI9341_S5P,51,52,53,49,50);
+UTFT my8bitGLCD(ILI9325D_8,38,39,40,41);
+UTFT myCPLDGLCD(CTE50CPLD,38,39,40,41);
+
+static const char *s_outDir = NULL;
+static int         s_failures = 0;
+
+//---------------------------------------------------------------------------------------------------
+
+// usec is the host time of the scenario. It includes the simulated
+// controller, so only compare it between scenarios doing the same work.
+static void report( const char *name, long usec )
+{
+  printf( "%-28s %9lu %9lu %9lu %7lu  %08lx %9ld\n", name,
+          UTFTSim::stats.commands, UTFTSim::stats.data, UTFTSim::stats.pixels,
+          UTFTSim::stats.cs_toggles, (unsigned long)UTFTSim::checksum(), usec );
+
+  if ( s_outDir != NULL )
+  {
+    char filename[256];
+    snprintf( filename, sizeof(filename), "%s/%s.ppm", s_outDir, name );
+    UTFTSim::writePPM( filename );
+  }
+}
+
+// A scenario that checks its image calls this, a failed check makes the bench exit with 1.
+static void check( boolean ok, const char *what )
+{
+  if ( !ok )
+  {
+    printf( "  FAIL: %s\n", what );
+    s_failures++;
+  }
+}
+
+//---------------------------------------------------------------------------------------------------
+
+static void begin()
+{
+  UTFTSim::attach( &myGLCD );
+  myGLCD.clrScr();
+  UTFTSim::resetStats();
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Line segments as CGraph::addData produces them: a few pixels in x per
+// sample with slopes from flat to steep.
+static const int s_slopes[][2] = { {1,1}, {1,6}, {1,20}, {2,3}, {3,1}, {4,15}, {8,2}, {25,6}, {50,30} };
+
+static void drawSlopes( boolean pixelwise )
+{
+  myGLCD.setColor( 255, 0, 0 );
+
+  for ( unsigned int s = 0; s < sizeof(s_slopes) / sizeof(s_slopes[0]); s++ )
+  {
+    int dx = s_slopes[s][0], dy = s_slopes[s][1];
+    int y  = 20 + 24 * s;
+
+    for ( int x = 10; x + dx < 310; x += dx )
+    {
+      int y1 = y + ( ( x / dx ) & 1 ? dy / 2 : -dy / 2 );
+      int y2 = y + ( ( x / dx ) & 1 ? -dy / 2 : dy / 2 );
+
+      if ( pixelwise )
+        myGLCD._draw_line_pixels( x, y1, x + dx, y2 );
+      else
+        myGLCD.drawLine( x, y1, x + dx, y2 );
+    }
+  }
+}
+
+static void benchLinesPixelwise() { drawSlopes( true ); }
+static void benchLinesSpans()     { drawSlopes( false ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// drawCircle() and fillCircle() as they were before the span versions,
+// built from the low level functions of UTFT
+static void legacyDrawCircle( int x, int y, int radius )
+{
+  int f = 1 - radius;
+  int ddF_x = 1;
+  int ddF_y = -2 * radius;
+  int x1 = 0;
+  int y1 = radius;
+  const int pts[8][2] = { {1,1}, {-1,1}, {1,-1}, {-1,-1} };
+
+  cbi( myGLCD.P_CS, myGLCD.B_CS );
+  for ( int i = 0; i < 4; i++ )
+  {
+    int px = ( i < 2 ) ? x : x + ( i == 2 ? radius : -radius );
+    int py = ( i < 2 ) ? y + ( i == 0 ? radius : -radius ) : y;
+    myGLCD.setXY( px, py, px, py );
+    myGLCD.LCD_Write_DATA( myGLCD.fch, myGLCD.fcl );
+  }
+  while ( x1 < y1 )
+  {
+    if ( f >= 0 )
+    {
+      y1--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x1++;
+    ddF_x += 2;
+    f += ddF_x;
+    for ( int i = 0; i < 4; i++ )
+    {
+      myGLCD.setXY( x + pts[i][0] * x1, y + pts[i][1] * y1, x + pts[i][0] * x1, y + pts[i][1] * y1 );
+      myGLCD.LCD_Write_DATA( myGLCD.fch, myGLCD.fcl );
+      myGLCD.setXY( x + pts[i][0] * y1, y + pts[i][1] * x1, x + pts[i][0] * y1, y + pts[i][1] * x1 );
+      myGLCD.LCD_Write_DATA( myGLCD.fch, myGLCD.fcl );
+    }
+  }
+  sbi( myGLCD.P_CS, myGLCD.B_CS );
+  myGLCD.clrXY();
+  myGLCD.invalidateXY();
+}
+
+static void legacyFillCircle( int x, int y, int radius )
+{
+  for ( int y1 = -radius; y1 <= 0; y1++ )
+    for ( int x1 = -radius; x1 <= 0; x1++ )
+      if ( x1 * x1 + y1 * y1 <= radius * radius )
+      {
+        myGLCD.drawHLine( x + x1, y + y1, 2 * ( -x1 ) );
+        myGLCD.drawHLine( x + x1, y - y1, 2 * ( -x1 ) );
+        break;
+      }
+}
+
+// Concentric outlines and a bullseye of fills, radius 10 to 100
+static void drawCircles( boolean legacy )
+{
+  for ( int r = 10; r <= 100; r += 10 )
+  {
+    myGLCD.setColor( 255, 255, 255 );
+    if ( legacy )
+      legacyDrawCircle( 105, 120, r );
+    else
+      myGLCD.drawCircle( 105, 120, r );
+  }
+  for ( int r = 100; r >= 10; r -= 10 )
+  {
+    myGLCD.setColor( r * 2, 255 - r * 2, ( r / 10 ) & 1 ? 255 : 0 );
+    if ( legacy )
+      legacyFillCircle( 215, 120, r );
+    else
+      myGLCD.fillCircle( 215, 120, r );
+  }
+}
+
+static void benchCirclesLegacy() { drawCircles( true ); }
+static void benchCirclesSpans()  { drawCircles( false ); }
+
+// Bus cost of a single circle per radius, legacy -> span version
+static void benchCircleCosts()
+{
+  for ( int r = 10; r <= 100; r += 10 )
+  {
+    unsigned long cost[4][2];
+
+    for ( int i = 0; i < 4; i++ )
+    {
+      myGLCD.invalidateXY();
+      UTFTSim::resetStats();
+      switch ( i )
+      {
+        case 0: legacyDrawCircle( 160, 120, r ); break;
+        case 1: myGLCD.drawCircle( 160, 120, r ); break;
+        case 2: legacyFillCircle( 160, 120, r ); break;
+        case 3: myGLCD.fillCircle( 160, 120, r ); break;
+      }
+      cost[i][0] = UTFTSim::stats.commands;
+      cost[i][1] = UTFTSim::stats.data;
+    }
+    printf( "  r=%-3d drawCircle %5lu/%5lu -> %5lu/%5lu   fillCircle %5lu/%5lu -> %5lu/%5lu  (commands/data)\n", r,
+            cost[0][0], cost[0][1], cost[1][0], cost[1][1], cost[2][0], cost[2][1], cost[3][0], cost[3][1] );
+  }
+}
+
+// Round gauges built from arcs and annuli
+static void benchArcs()
+{
+  for ( int g = 0; g < 4; g++ )
+  {
+    int x = 45 + 77 * g, y = 60;
+
+    myGLCD.setColor( 64, 64, 64 );
+    myGLCD.fillAnnulus( x, y, 26, 34, 225, 135 );
+    myGLCD.setColor( 255, 128, 0 );
+    myGLCD.fillAnnulus( x, y, 26, 34, 225, 225 + 67 * ( g + 1 ) );
+    myGLCD.setColor( 255, 255, 255 );
+    myGLCD.drawAnnulus( x, y, 25, 35, 225, 135 );
+    myGLCD.drawArc( x, y, 20, 300, 60 );
+
+    myGLCD.setColor( 0, 160, 255 );
+    myGLCD.fillAnnulus( x, 170, 0, 30, 90 * g, 90 * g + 45 + 60 * g );
+    myGLCD.setColor( 255, 255, 0 );
+    myGLCD.fillAnnulus( x, 170, 31, 34 );
+  }
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// A widget sized area: gradient pixels, a stripe of runs and an icon from
+// PROGMEM, drawn pixel by pixel or as one streamed write per area
+static const uint16_t s_icon[16 * 16] PROGMEM = {
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xF800, 0xF800, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xFFE0, 0xFFE0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+  0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+};
+
+static word gradient( int x, int y )
+{
+  return ( ( x * 31 / 99 ) << 11 ) | ( ( y * 63 / 59 ) << 5 ) | ( ( x + y ) & 31 );
+}
+
+static void drawStreamArea( boolean stream )
+{
+  uint16_t row[100];
+
+  for ( int y = 0; y < 60; y++ )
+  {
+    for ( int x = 0; x < 100; x++ )
+      row[x] = gradient( x, y );
+    if ( stream )
+    {
+      if ( y == 0 )
+        myGLCD.beginWrite( 20, 20, 119, 79 );
+      myGLCD.pushPixels( row, 100 );
+    }
+    else
+      for ( int x = 0; x < 100; x++ )
+      {
+        myGLCD.setColor( row[x] );
+        myGLCD.drawPixel( 20 + x, 20 + y );
+      }
+  }
+  if ( stream )
+    myGLCD.endWrite();
+
+  // Stripes of 7 pixels, wrapping over the rows of the area
+  if ( stream )
+    myGLCD.beginWrite( 140, 20, 239, 79 );
+  for ( long i = 0; i < 100L * 60; i += 7 )
+  {
+    word color = ( i / 7 ) & 1 ? VGA_YELLOW : VGA_NAVY;
+    int  n     = min( 7L, 100L * 60 - i );
+
+    if ( stream )
+      myGLCD.pushColor( color, n );
+    else
+      for ( int k = 0; k < n; k++ )
+      {
+        myGLCD.setColor( color );
+        myGLCD.drawPixel( 140 + ( i + k ) % 100, 20 + ( i + k ) / 100 );
+      }
+  }
+  if ( stream )
+    myGLCD.endWrite();
+
+  for ( int k = 0; k < 4; k++ )
+  {
+    if ( stream )
+    {
+      myGLCD.beginWrite( 20 + 20 * k, 100, 35 + 20 * k, 115 );
+      myGLCD.pushPixels_P( s_icon, 16 * 16 );
+      myGLCD.endWrite();
+    }
+    else
+      for ( int i = 0; i < 16 * 16; i++ )
+      {
+        myGLCD.setColor( pgm_read_word( &s_icon[i] ) );
+        myGLCD.drawPixel( 20 + 20 * k + i % 16, 100 + i / 16 );
+      }
+  }
+}
+
+static void benchStreamPixelwise() { drawStreamArea( false ); }
+static void benchStreamWrite()     { drawStreamArea( true ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// printChar() as it was before the glyph blitter: one window per glyph row
+// in landscape and a 2x2 window for every set pixel of transparent text
+static void legacyPrintChar( byte c, int x, int y )
+{
+  int  bw   = myGLCD.cfont.x_size / 8;
+  word temp = ( ( c - myGLCD.cfont.offset ) * ( bw * myGLCD.cfont.y_size ) ) + 4;
+  word fg   = ( myGLCD.fch << 8 ) | myGLCD.fcl;
+  word bg   = ( myGLCD.bch << 8 ) | myGLCD.bcl;
+
+  cbi( myGLCD.P_CS, myGLCD.B_CS );
+  if ( !myGLCD._transparent && myGLCD.orient == PORTRAIT )
+  {
+    myGLCD.setXY( x, y, x + myGLCD.cfont.x_size - 1, y + myGLCD.cfont.y_size - 1 );
+    for ( int j = 0; j < bw * myGLCD.cfont.y_size; j++ )
+    {
+      byte ch = pgm_read_byte( &myGLCD.cfont.font[temp + j] );
+      for ( int i = 0; i < 8; i++ )
+        myGLCD.setPixel( ch & ( 1 << ( 7 - i ) ) ? fg : bg );
+    }
+  }
+  else if ( !myGLCD._transparent )
+  {
+    for ( int j = 0; j < myGLCD.cfont.y_size; j++, temp += bw )
+    {
+      myGLCD.setXY( x, y + j, x + myGLCD.cfont.x_size - 1, y + j );
+      for ( int zz = bw - 1; zz >= 0; zz-- )
+      {
+        byte ch = pgm_read_byte( &myGLCD.cfont.font[temp + zz] );
+        for ( int i = 0; i < 8; i++ )
+          myGLCD.setPixel( ch & ( 1 << i ) ? fg : bg );
+      }
+    }
+  }
+  else
+  {
+    for ( int j = 0; j < myGLCD.cfont.y_size; j++, temp += bw )
+      for ( int zz = 0; zz < bw; zz++ )
+      {
+        byte ch = pgm_read_byte( &myGLCD.cfont.font[temp + zz] );
+        for ( int i = 0; i < 8; i++ )
+        {
+          myGLCD.setXY( x + i + zz * 8, y + j, x + i + zz * 8 + 1, y + j + 1 );
+          if ( ch & ( 1 << ( 7 - i ) ) )
+            myGLCD.setPixel( fg );
+        }
+      }
+  }
+  sbi( myGLCD.P_CS, myGLCD.B_CS );
+  myGLCD.clrXY();
+  myGLCD.invalidateXY();
+}
+
+static void drawString( const char *st, int x, int y, boolean legacy )
+{
+  for ( int i = 0; st[i] != 0; i++ )
+    if ( legacy )
+      legacyPrintChar( st[i], x + i * myGLCD.cfont.x_size, y );
+    else
+      myGLCD.printChar( st[i], x + i * myGLCD.cfont.x_size, y );
+}
+
+// Readouts like the printNumF() calls in loop(), in both orientations,
+// plus transparent labels. Transparent text stays in portrait: the legacy
+// code drew it one pixel to the right in landscape.
+static void setOrient( byte orient )
+{
+  // Like InitLCD() would do it: the screen clip follows the orientation
+  myGLCD.orient = orient;
+  myGLCD.invalidateXY();
+  myGLCD.clip.x1 = 0;
+  myGLCD.clip.y1 = 0;
+  myGLCD.clip.x2 = myGLCD.getDisplayXSize() - 1;
+  myGLCD.clip.y2 = myGLCD.getDisplayYSize() - 1;
+}
+
+static void drawReadouts( boolean legacy )
+{
+  static const byte orients[2] = { LANDSCAPE, PORTRAIT };
+  char buf[16];
+
+  for ( int o = 0; o < 2; o++ )
+  {
+    setOrient( orients[o] );
+    myGLCD.setBackColor( 0, 0, 0 );
+    for ( int t = 0; t < 50; t++ )
+    {
+      snprintf( buf, sizeof(buf), "%6.2f", sin( t * 0.3 ) * 100.0 );
+      myGLCD.setFont( SmallFont );
+      myGLCD.setColor( 0, 255, 0 );
+      drawString( buf, 10, 10 + 100 * o, legacy );
+      myGLCD.setFont( BigFont );
+      myGLCD.setColor( 255, 255, 0 );
+      drawString( buf, 10, 30 + 100 * o, legacy );
+      myGLCD.setFont( SevenSegNumFont );
+      myGLCD.setColor( 0, 255, 255 );
+      drawString( "0123", 100, 10 + 100 * o, legacy );
+    }
+  }
+
+  myGLCD.setBackColor( VGA_TRANSPARENT );
+  myGLCD.setColor( 255, 255, 255 );
+  myGLCD.setFont( SmallFont );
+  drawString( "Ladedruck [bar]", 10, 220, legacy );
+  myGLCD.setFont( BigFont );
+  drawString( "Gaspedal", 10, 250, legacy );
+
+  myGLCD.setBackColor( 0, 0, 0 );
+  setOrient( LANDSCAPE );
+}
+
+static void benchTextLegacy() { drawReadouts( true ); }
+static void benchTextGlyphs() { drawReadouts( false ); }
+
+// rotateChar() as it was before the fixed point version: cos() and sin()
+// in double for every pixel and a 2x2 window per pixel. Its angle is off
+// by 0.3 percent and in landscape the 2x2 window moves every pixel one to
+// the right, so the images differ from the new version by a pixel.
+static void legacyRotateChar( byte c, int x, int y, int pos, int deg )
+{
+  int    bw     = myGLCD.cfont.x_size / 8;
+  word   temp   = ( ( c - myGLCD.cfont.offset ) * ( bw * myGLCD.cfont.y_size ) ) + 4;
+  double radian = deg * 0.0175;
+
+  cbi( myGLCD.P_CS, myGLCD.B_CS );
+  for ( int j = 0; j < myGLCD.cfont.y_size; j++, temp += bw )
+    for ( int zz = 0; zz < bw; zz++ )
+    {
+      byte ch = pgm_read_byte( &myGLCD.cfont.font[temp + zz] );
+      for ( int i = 0; i < 8; i++ )
+      {
+        int u    = i + zz * 8 + pos * myGLCD.cfont.x_size;
+        int newx = x + ( ( u * cos( radian ) ) - ( j * sin( radian ) ) );
+        int newy = y + ( ( j * cos( radian ) ) + ( u * sin( radian ) ) );
+
+        myGLCD.setXY( newx, newy, newx + 1, newy + 1 );
+        if ( ch & ( 1 << ( 7 - i ) ) )
+          myGLCD.setPixel( ( myGLCD.fch << 8 ) | myGLCD.fcl );
+        else if ( !myGLCD._transparent )
+          myGLCD.setPixel( ( myGLCD.bch << 8 ) | myGLCD.bcl );
+      }
+    }
+  sbi( myGLCD.P_CS, myGLCD.B_CS );
+  myGLCD.clrXY();
+  myGLCD.invalidateXY();
+}
+
+// Vertical axis labels of five graphs, redrawn ten times, and a slanted
+// caption
+static void drawRotatedLabels( boolean legacy )
+{
+  static const char *labels[5] = { "5.5", "-1.0", "10", "2.5", "25" };
+
+  myGLCD.setFont( SmallFont );
+  myGLCD.setBackColor( 0, 0, 0 );
+  for ( int k = 0; k < 10; k++ )
+    for ( int g = 0; g < 5; g++ )
+    {
+      myGLCD.setColor( 255, 255, 255 );
+      for ( int i = 0; labels[g][i] != 0; i++ )
+        if ( legacy )
+          legacyRotateChar( labels[g][i], 10 + 12 * g, 40 + 40 * g, i, 270 );
+        else
+          myGLCD.rotateChar( labels[g][i], 10 + 12 * g, 40 + 40 * g, i, 270 );
+    }
+
+  myGLCD.setColor( 255, 255, 0 );
+  for ( int i = 0; i < 8; i++ )
+    if ( legacy )
+      legacyRotateChar( "Ladedruck"[i], 120, 60, i, 30 );
+    else
+      myGLCD.rotateChar( "Ladedruck"[i], 120, 60, i, 30 );
+}
+
+static void benchRotatedLegacy() { drawRotatedLabels( true ); }
+static void benchRotatedFixed()  { drawRotatedLabels( false ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// Fills in 8 bit mode with colors whose high and low byte differ. Before
+// _fast_fill_8x2() fillRect() drew these as lines and every line wrote
+// its pixels one by one with LCD_Write_DATA().
+static void legacyFillRect8( int x1, int y1, int x2, int y2 )
+{
+  for ( int x = x1; x <= x2; x++ )
+  {
+    cbi( my8bitGLCD.P_CS, my8bitGLCD.B_CS );
+    my8bitGLCD.setXY( x, y1, x, y2 );
+    for ( int y = y1; y <= y2; y++ )
+      my8bitGLCD.LCD_Write_DATA( my8bitGLCD.fch, my8bitGLCD.fcl );
+    sbi( my8bitGLCD.P_CS, my8bitGLCD.B_CS );
+  }
+}
+
+static void legacyHLine8( int x, int y, int l )
+{
+  cbi( my8bitGLCD.P_CS, my8bitGLCD.B_CS );
+  my8bitGLCD.setXY( x, y, x + l, y );
+  for ( int i = 0; i < l + 1; i++ )
+    my8bitGLCD.LCD_Write_DATA( my8bitGLCD.fch, my8bitGLCD.fcl );
+  sbi( my8bitGLCD.P_CS, my8bitGLCD.B_CS );
+}
+
+static void begin8bit()
+{
+  my8bitGLCD.InitLCD();
+  my8bitGLCD.clrScr();
+  UTFTSim::resetStats();
+}
+
+// Progress bars and graph backgrounds in colors like the ones of main.cpp
+static void drawFills8( boolean legacy )
+{
+  static const word colors[4] = { VGA_GREEN, VGA_RED, VGA_NAVY, VGA_TEAL };
+
+  for ( int k = 0; k < 20; k++ )
+  {
+    my8bitGLCD.setColor( colors[k & 3] );
+    if ( legacy )
+    {
+      legacyFillRect8( 50, 165, 50 + 10 * k, 180 );
+      legacyFillRect8( 10, 10, 309, 50 );
+    }
+    else
+    {
+      my8bitGLCD.fillRect( 50, 165, 50 + 10 * k, 180 );
+      my8bitGLCD.fillRect( 10, 10, 309, 50 );
+    }
+    for ( int i = 0; i < 40; i++ )
+      if ( legacy )
+        legacyHLine8( 10, 60 + i, 299 );
+      else
+        my8bitGLCD.drawHLine( 10, 60 + i, 299 );
+  }
+}
+
+static void benchFills8Legacy() { drawFills8( true ); }
+static void benchFills8Fast()   { drawFills8( false ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// The bitmaps of bench_bitmaps.c as raw RGB565 arrays for drawBitmap()
+static uint16_t s_rawDial[120 * 120];
+static uint16_t s_rawIcon[32 * 32];
+static uint16_t s_rawMono[24 * 21];
+static uint16_t s_rawBar[60 * 12];
+
+static void capture( const unsigned char *bitmap, uint16_t *raw, int sx, int sy )
+{
+  myGLCD.drawPackedBitmap( 0, 0, bitmap );
+  for ( int i = 0; i < sx * sy; i++ )
+    raw[i] = UTFTSim::getPixel( i % sx, i / sx );
+}
+
+static void beginBitmapsRaw()
+{
+  begin();
+  capture( bmDial, s_rawDial, 120, 120 );
+  capture( bmIcon, s_rawIcon, 32, 32 );
+  capture( bmMono, s_rawMono, 24, 21 );
+  capture( bmBar, s_rawBar, 60, 12 );
+  myGLCD.clrScr();
+  UTFTSim::resetStats();
+}
+
+// A dial background redrawn a few times plus some icons. The dial on the
+// left is stored in landscape order, the one on the right in reading order.
+static void drawBitmaps( boolean packed )
+{
+  for ( int k = 0; k < 5; k++ )
+  {
+    if ( packed )
+    {
+      myGLCD.drawPackedBitmap( 10, 10, bmDialLandscape );
+      myGLCD.drawPackedBitmap( 140, 10, bmDial );
+      myGLCD.drawPackedBitmap( 270, 10, bmIcon );
+      myGLCD.drawPackedBitmap( 270, 50, bmIcon16 );
+      myGLCD.drawPackedBitmap( 270, 90, bmMono );
+      myGLCD.drawPackedBitmap( 140, 140, bmBar );
+    }
+    else
+    {
+      myGLCD.drawBitmap( 10, 10, 120, 120, s_rawDial );
+      myGLCD.drawBitmap( 140, 10, 120, 120, s_rawDial );
+      myGLCD.drawBitmap( 270, 10, 32, 32, s_rawIcon );
+      myGLCD.drawBitmap( 270, 50, 32, 32, s_rawIcon );
+      myGLCD.drawBitmap( 270, 90, 24, 21, s_rawMono );
+      myGLCD.drawBitmap( 140, 140, 60, 12, s_rawBar );
+    }
+  }
+}
+
+static void benchBitmapsRaw()    { drawBitmaps( false ); }
+static void benchBitmapsPacked() { drawBitmaps( true ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// The same primitives on UTFT and on UTFT_Static, with the same image. The
+// fast fill of UTFT sends up to one word more per line, which wraps onto
+// the first pixel of the window.
+template<class T> static void drawPrimitives( T &lcd )
+{
+  for ( int i = 0; i < 20; i++ )
+  {
+    lcd.setColor( 10 * i, 255 - 10 * i, 128 );
+    lcd.fillRect( 5 + 15 * i, 5, 15 + 15 * i, 60 );
+    lcd.drawRect( 5 + 15 * i, 65, 15 + 15 * i, 80 );
+    lcd.drawHLine( 5, 85 + i, 100 + 10 * i );
+    lcd.drawVLine( 5 + 15 * i, 110, 20 + i );
+  }
+
+  lcd.setColor( 255, 255, 0 );
+  for ( int i = 0; i < 40; i++ )
+    lcd.drawLine( 160, 190, 8 * i, i & 1 ? 150 : 235 );
+  for ( int i = 0; i < 300; i++ )
+    lcd.drawPixel( 10 + i, 140 + ( i * 7 ) % 8 );
+}
+
+static void benchPrimitivesRuntime()
+{
+  drawPrimitives( myGLCD );
+}
+
+static void beginStatic()
+{
+  myStaticGLCD.InitLCD();
+  myStaticGLCD.clrScr();
+  UTFTSim::resetStats();
+}
+
+static void benchPrimitivesStatic()
+{
+  drawPrimitives( myStaticGLCD );
+}
+
+// The serial display models: fills go through _fast_fill_serial(), which
+// uses the hardware SPI on the Mega when USE_HW_SPI is defined
+static void beginSerial()
+{
+  mySerialGLCD.InitLCD();
+  mySerialGLCD.clrScr();
+  UTFTSim::resetStats();
+}
+
+static void benchPrimitivesSerial()
+{
+  drawPrimitives( mySerialGLCD );
+  mySerialGLCD.setColor( VGA_NAVY );
+  mySerialGLCD.fillRect( 170, 5, 310, 120 );
+  mySerialGLCD.setColor( VGA_RED );
+  mySerialGLCD.fillRoundRect( 180, 20, 300, 100 );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// The screen of src/main.cpp, updated for 10 seconds at the loop() rate.
+// With a band buffer the graphs 3 to 5 draw composited through UTFT::beginBand().
+// With a list buffer the widget updates of each pass are recorded into a
+// display list and sent optimized by UTFT::endList(). With dirty set all widgets
+// are layers of a CDirtyRects, painted once per pass. Graph 1 shows two traces.
+static void runMainScreen( word *band, int bandSize, byte *list, int listSize, boolean dirty )
+{
+  CDirtyRects  dirtyRects(&myGLCD);
+  CGraph       TSens1Graph(50,0,  270,40,0,5.5,-1,1, &myGLCD);
+  CGraph       TSens3Graph(50,40, 270,40,0,10,-1,1, &myGLCD);
+  CGraph       TSens4Graph(50,80, 270,40,0,2.5,-1,1, &myGLCD);
+  CGraph       TSens5Graph(50,120,270,40,0,25, -1,1, &myGLCD);
+  CProgressBar PBoost(50, 165, 320-50, 16, 0.0f, 100.0f, &myGLCD);
+  CProgressBar PAPP  (50, 165+19, 320-50, 16, 0.0f, 100.0f, &myGLCD);
+  uText        txtPlot(&myGLCD, 320, 240);
+
+  TSens1Graph.addTrace(0,255,0);
+  TSens3Graph.setLineColor(0,0,255);
+  TSens4Graph.setLineColor(0,255,255);
+
+  TSens1Graph.setEraserPixelWidth(40);
+  TSens3Graph.setEraserPixelWidth(30);
+  TSens5Graph.setEraserPixelWidth(25);
+
+  TSens1Graph.redrawAxis();
+  TSens3Graph.redrawAxis();
+  TSens4Graph.redrawAxis();
+  TSens5Graph.redrawAxis();
+
+  PBoost.setBaseValue( 20.0f );
+  PBoost.redraw();
+  PAPP.setMaxAlert( 90.0f );
+  PAPP.redraw();
+
+  TSens1Graph.setXGridInterval( 0.5f );
+  TSens1Graph.setYGridInterval( 0.5f );
+  TSens3Graph.setYGridInterval( 0.6f );
+  TSens5Graph.setXGridInterval( 2.5f );
+
+  TSens1Graph.setCursor(true);
+  TSens3Graph.setCursor(true);
+  TSens4Graph.setCursor(true);
+  TSens5Graph.setCursor(true);
+
+  if ( dirty )
+  {
+    TSens1Graph.setDirtyRects( &dirtyRects );
+    TSens3Graph.setDirtyRects( &dirtyRects );
+    TSens4Graph.setDirtyRects( &dirtyRects );
+    TSens5Graph.setDirtyRects( &dirtyRects );
+    PBoost.setDirtyRects( &dirtyRects );
+    PAPP.setDirtyRects( &dirtyRects );
+  }
+
+  TSens1Graph.setBandBuffer( band, bandSize );
+  TSens3Graph.setBandBuffer( band, bandSize );
+  TSens4Graph.setBandBuffer( band, bandSize );
+  TSens5Graph.setBandBuffer( band, bandSize );
+
+  txtPlot.setFont(LucidaConsole10a);
+  txtPlot.print(0, 165, "Ladedr", NULL );
+  txtPlot.print(0, 165+19, "Gasped", NULL );
+
+  unsigned long tmrTxtUpdate1 = 0, tmrTxtUpdate2 = 0;
+  unsigned long recorded = myGLCD.dlist.recorded, replayed = myGLCD.dlist.replayed;
+
+  for ( unsigned long t = 0; t <= 10000; t += 12 )
+  {
+    float y = sin( ((float)t * 2.0f * (float)(M_PI)) / 1000.0f / 2.0f);
+    float z = sin( ((float)t * 2.0f * (float)(M_PI)) / 1000.0f / 8.0f);
+
+    if ( list != NULL )
+      myGLCD.beginList( list, listSize );
+
+    float TSens12[2] = { y, y*y };
+
+    TSens1Graph.addData((float)t/1000.0f, TSens12 );
+    TSens3Graph.addData((float)t/1000.0f, y );
+    TSens4Graph.addData((float)t/1000.0f, 0.7*y );
+    TSens5Graph.addData((float)t/1000.0f, 0.9f*y );
+
+    PAPP.update(z*100.0f);
+    PBoost.update(z*z*100.0f);
+
+    dirtyRects.paint();
+
+    if ( list != NULL )
+      myGLCD.endList();
+
+    if( t - tmrTxtUpdate1 > 200 )
+    {
+      myGLCD.setFont(SmallFont);
+      myGLCD.setColor( 0, 255, 0 );
+      myGLCD.printNumF( y, 2, 0, 0, ',', 5, ' ' );
+      myGLCD.setColor( 0, 0, 255 );
+      myGLCD.printNumF( y, 2, 0, 40, ',', 5, ' ' );
+      tmrTxtUpdate1 = t;
+    }
+    if( t - tmrTxtUpdate2 > 555 )
+    {
+      myGLCD.setFont(SmallFont);
+      myGLCD.setColor( 0, 255, 255 );
+      myGLCD.printNumF( y, 2, 0, 80, ',', 5, ' ' );
+      myGLCD.setColor( 255, 0, 0 );
+      myGLCD.printNumF( y, 2, 0, 120, ',', 5, ' ' );
+      tmrTxtUpdate2 = t;
+    }
+  }
+
+  if ( list != NULL )
+    printf( "  list: %lu ops recorded, %lu sent\n", myGLCD.dlist.recorded - recorded, myGLCD.dlist.replayed - replayed );
+  if ( dirty )
+  {
+    const CDirtyRects::stats &st = dirtyRects.getStats();
+
+    printf( "  dirty: %lu invalidated, %lu merged, %lu forced, %lu rects in %lu frames, %lu pixels\n",
+            st.invalidated, st.merged, st.forced, st.rects, st.frames, st.pixels );
+  }
+}
+
+static void benchMainScreen()
+{
+  runMainScreen( NULL, 0, NULL, 0, false );
+}
+
+// 4 columns of the 37 pixel high plot areas, 296 bytes
+static void benchMainScreenBand()
+{
+  static word band[37 * 4];
+
+  runMainScreen( band, 37 * 4, NULL, 0, false );
+}
+
+// Room for 20 rectangles, 220 bytes on AVR
+static void benchMainScreenList()
+{
+  static byte list[20 * ( 1 + 4 * sizeof(int) + sizeof(word) )];
+
+  runMainScreen( NULL, 0, list, sizeof(list), false );
+}
+
+static void benchMainScreenDirty()
+{
+  runMainScreen( NULL, 0, NULL, 0, true );
+}
+
+// The band of main_screen_band
+static void benchMainScreenDirtyBand()
+{
+  static word band[37 * 4];
+
+  runMainScreen( band, 37 * 4, NULL, 0, true );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// A bar with its value printed on top. Directly the text is drawn over the bar, in
+// bands every pixel is sent once. The bands are 54x16 tiles, 1728 bytes.
+static void drawBarReadouts( boolean banded )
+{
+  static word band[54 * 16];
+
+  myGLCD.setFont( SmallFont );
+  myGLCD.setBackColor( VGA_TRANSPARENT );
+
+  for ( int i = 0; i < 100; i++ )
+  {
+    int   y   = 60 + ( i % 4 ) * 20;
+    float val = 50.0f + 49.0f * sin( i * 0.37f );
+    int   bx  = 50 + (int)( val * 2.69f );
+
+    for ( int x1 = 50; x1 < 320; x1 += ( banded ? 54 : 270 ) )
+    {
+      int x2 = banded ? x1 + 53 : 319;
+
+      if ( banded )
+        myGLCD.beginBand( x1, y, x2, y + 15, band );
+
+      myGLCD.setColor( 0, 160, 0 );
+      myGLCD.fillRect( 50, y, bx, y + 15 );
+      myGLCD.setColor( 24, 24, 24 );
+      myGLCD.fillRect( bx + 1, y, 319, y + 15 );
+      myGLCD.setColor( 255, 255, 255 );
+      myGLCD.printNumF( val, 1, 150, y + 2 );
+      myGLCD.print( (char *)"%", 190, y + 2 );
+
+      if ( banded )
+        myGLCD.endBand();
+    }
+  }
+
+  myGLCD.setBackColor( 0, 0, 0 );
+}
+
+static void benchBarTextDirect() { drawBarReadouts( false ); }
+static void benchBarTextBand()   { drawBarReadouts( true ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// A curve running into saturation at both ends of the y-axis. The segments keep their
+// slope up to the edge of the plot and follow the edge while saturated. The plain run
+// without the cursor gives its share of the direct drawing.
+static void drawSaturatedGraph( word *band, int bandSize, boolean cursor )
+{
+  CGraph graph(50,40,270,80,0,5,-1,1, &myGLCD);
+
+  graph.setEraserPixelWidth(30);
+  graph.setYGridInterval(0.5f);
+  graph.setCursor(cursor);
+  graph.setBandBuffer( band, bandSize );
+  graph.redrawAxis();
+
+  for ( unsigned long t = 0; t <= 8000; t += 12 )
+    graph.addData( (float)t / 1000.0f, 1.6f * sin( (float)t * 2.0f * (float)(M_PI) / 1500.0f ) );
+}
+
+static void benchGraphSaturated()      { drawSaturatedGraph( NULL, 0, true ); }
+static void benchGraphSaturatedBand()  { static word band[77 * 4]; drawSaturatedGraph( band, 77 * 4, true ); }
+static void benchGraphSaturatedPlain() { drawSaturatedGraph( NULL, 0, false ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// A screen switch while a graph with a history is running: after 7 seconds the screen is
+// cleared and the graph redrawn from its history, then it runs on for one more second. The
+// line after the scenario gives the cost of the redraw and the plot pixels that differ from
+// the image before the switch. Drawn directly the old eraser also removes the grid.
+static void drawHistoryGraph( word *band, int bandSize )
+{
+  static graphSample history[2 * ( 270 - 2 )];
+  static word        before[78 * 268];
+  CGraph             graph(50,40,270,80,0,5,-1,1, &myGLCD);
+  unsigned long      commands, data;
+  int                differ = 0;
+
+  graph.setEraserPixelWidth(30);
+  graph.setXGridInterval(1.0f);
+  graph.setYGridInterval(0.5f);
+  graph.setCursor(true);
+  graph.setBandBuffer( band, bandSize );
+  graph.setHistoryBuffer( history, 2 * ( 270 - 2 ) );
+  graph.redrawAxis();
+
+  for ( unsigned long t = 0; t <= 7000; t += 12 )
+    graph.addData( (float)t / 1000.0f, 1.2f * sin( (float)t * 2.0f * (float)(M_PI) / 1500.0f ) );
+
+  for ( int y = 0; y < 78; y++ )
+    for ( int x = 0; x < 268; x++ )
+      before[y * 268 + x] = UTFTSim::getPixel( 51 + x, 41 + y );
+
+  myGLCD.clrScr();
+  commands = UTFTSim::stats.commands;
+  data     = UTFTSim::stats.data;
+  graph.redrawAxis();
+  commands = UTFTSim::stats.commands - commands;
+  data     = UTFTSim::stats.data - data;
+
+  for ( int y = 0; y < 78; y++ )
+    for ( int x = 0; x < 268; x++ )
+      differ += ( before[y * 268 + x] != UTFTSim::getPixel( 51 + x, 41 + y ) );
+
+  for ( unsigned long t = 7012; t <= 8000; t += 12 )
+    graph.addData( (float)t / 1000.0f, 1.2f * sin( (float)t * 2.0f * (float)(M_PI) / 1500.0f ) );
+
+  printf( "  history: redraw %lu commands, %lu data, %d of %d plot pixels differ\n",
+          commands, data, differ, 78 * 268 );
+  check( differ == 0, "history redraw differs from the plot before the switch" );
+}
+
+static void benchGraphHistory()     { drawHistoryGraph( NULL, 0 ); }
+static void benchGraphHistoryBand() { static word band[77 * 4]; drawHistoryGraph( band, 77 * 4 ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// Spikes of 2 ms at 1 kHz input, one every 250 ms over a sweep of 5 seconds. A plot column
+// covers 18.7 ms, the spikes are drawn as spans of the columns they fall into. The line
+// after the scenario counts the spike columns that show the whole span of their samples.
+static float spikeValue( unsigned long t )
+{
+  return ( t % 250 ) == 100 || ( t % 250 ) == 101 ? 0.8f : 0.1f * sin( (float)t * 0.01f );
+}
+
+// Column and row of a sample, as addData() computes them
+static int spikeColumn( unsigned long t ) { return min( (int)( (float)t / 1000.0f / 5.0f * 267.0f ) + 51, 317 ); }
+static int spikeRow( float v )            { return (int)( ( 1.0f - v ) / 2.0f * 77.0f ) + 41; }
+
+static void drawSpikeGraph( word *band, int bandSize )
+{
+  CGraph graph(50,40,270,80,0,5,-1,1, &myGLCD);
+  int    spikes = 0, drawn = 0;
+
+  graph.setEraserPixelWidth(30);
+  graph.setYGridInterval(0.5f);
+  graph.setCursor(true);
+  graph.setBandBuffer( band, bandSize );
+  graph.redrawAxis();
+
+  for ( unsigned long t = 0; t < 5000; t++ )
+    graph.addData( (float)t / 1000.0f, spikeValue( t ) );
+
+  // The rows from the lowest to the highest sample of each spike column have to be drawn
+  for ( unsigned long t = 100; t < 5000; t += 250 )
+  {
+    int     x = spikeColumn( t ), minY = 1000, maxY = -1000;
+    boolean whole = true;
+
+    for ( unsigned long s = 0; s < 5000; s++ )
+      if ( spikeColumn( s ) == x )
+      {
+        minY = min( minY, spikeRow( spikeValue( s ) ) );
+        maxY = max( maxY, spikeRow( spikeValue( s ) ) );
+      }
+    for ( int y = minY; y <= maxY; y++ )
+      whole = whole && UTFTSim::getPixel( x, y ) == VGA_RED;
+
+    spikes++;
+    drawn += whole;
+  }
+  printf( "  spikes: %d of %d drawn\n", drawn, spikes );
+  check( drawn == spikes, "spike columns without the span of their samples" );
+}
+
+static void benchGraphSpikes()     { drawSpikeGraph( NULL, 0 ); }
+static void benchGraphSpikesBand() { static word band[77 * 4]; drawSpikeGraph( band, 77 * 4 ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// Auto-range through changing driving modes: idle around 0.3, 4 seconds of boost around
+// 2.5, then idle again until the boost has left the 5 second plot. The line after the
+// scenario gives the range changes and the cost of the addData() calls doing them; each
+// one redraws the graph from its history in one pass.
+static float drivingValue( unsigned long t )
+{
+  if ( t >= 4000 && t < 8000 )
+    return 2.5f + 0.5f * sin( (float)t * 0.004f );
+  return 0.3f + 0.05f * sin( (float)t * 0.003f );
+}
+
+static void drawAutoRangeGraph( word *band, int bandSize )
+{
+  static graphSample history[4 * ( 270 - 2 )];
+  CGraph             graph(50,40,270,80,0,5,-1,1, &myGLCD);
+  unsigned long      maxCommands = 0, maxData = 0, sumCommands = 0;
+
+  graph.setEraserPixelWidth(30);
+  graph.setYGridInterval(0.5f);
+  graph.setCursor(true);
+  graph.setBandBuffer( band, bandSize );
+  graph.setHistoryBuffer( history, 4 * ( 270 - 2 ) );
+  graph.setAutoRange( true, 0.2f );
+  graph.redrawAxis();
+
+  for ( unsigned long t = 0; t <= 16000; t += 5 )
+  {
+    unsigned long commands = UTFTSim::stats.commands, data = UTFTSim::stats.data;
+    unsigned int  rescales = graph.getRescales();
+
+    graph.addData( (float)t / 1000.0f, drivingValue( t ) );
+    if ( graph.getRescales() != rescales )
+    {
+      maxCommands  = max( maxCommands, UTFTSim::stats.commands - commands );
+      maxData      = max( maxData, UTFTSim::stats.data - data );
+      sumCommands += UTFTSim::stats.commands - commands;
+    }
+  }
+
+  printf( "  autorange: %u rescales, %lu commands, max %lu commands and %lu data per rescale\n",
+          graph.getRescales(), sumCommands, maxCommands, maxData );
+}
+
+static void benchGraphAutoRange()     { drawAutoRangeGraph( NULL, 0 ); }
+static void benchGraphAutoRangeBand() { static word band[77 * 4]; drawAutoRangeGraph( band, 77 * 4 ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// Six thermocouples in one plot for 5 seconds, as six graphs in the same rectangle and
+// as one graph with six traces. Each of the six graphs erases and draws the grid of its
+// columns again, the traces share that pass; with separate graphs the erasers also wipe
+// the curves of the graphs drawn before them.
+static const word s_overlayColors[6] = { VGA_RED, VGA_LIME, VGA_BLUE, VGA_AQUA, VGA_YELLOW, VGA_FUCHSIA };
+
+static void overlayValues( unsigned long t, float *vals )
+{
+  for ( int i = 0; i < 6; i++ )
+    vals[i] = 0.8f * sin( (float)t * 0.002f + (float)i * 0.5f ) - 0.1f * i + 0.25f;
+}
+
+static void benchGraphOverlaySeparate()
+{
+  CGraph graph0(50,40,270,80,0,5,-1,1, &myGLCD), graph1(50,40,270,80,0,5,-1,1, &myGLCD);
+  CGraph graph2(50,40,270,80,0,5,-1,1, &myGLCD), graph3(50,40,270,80,0,5,-1,1, &myGLCD);
+  CGraph graph4(50,40,270,80,0,5,-1,1, &myGLCD), graph5(50,40,270,80,0,5,-1,1, &myGLCD);
+  CGraph *graphs[6] = { &graph0, &graph1, &graph2, &graph3, &graph4, &graph5 };
+  float  vals[6];
+
+  for ( int i = 0; i < 6; i++ )
+  {
+    graphs[i]->setEraserPixelWidth(30);
+    graphs[i]->setYGridInterval(0.5f);
+    graphs[i]->setLineColor( s_overlayColors[i] );
+    graphs[i]->setCursor( i == 0 );
+  }
+  graph0.redrawAxis();
+
+  for ( unsigned long t = 0; t < 5000; t += 10 )
+  {
+    overlayValues( t, vals );
+    for ( int i = 0; i < 6; i++ )
+      graphs[i]->addData( (float)t / 1000.0f, vals[i] );
+  }
+}
+
+static void drawOverlayTraces( word *band, int bandSize )
+{
+  CGraph graph(50,40,270,80,0,5,-1,1, &myGLCD);
+  float  vals[6];
+
+  graph.setEraserPixelWidth(30);
+  graph.setYGridInterval(0.5f);
+  graph.setCursor(true);
+  graph.setBandBuffer( band, bandSize );
+  graph.setLineColor( s_overlayColors[0] );
+  for ( int i = 1; i < 6; i++ )
+    graph.addTrace( s_overlayColors[i] );
+  graph.redrawAxis();
+
+  for ( unsigned long t = 0; t < 5000; t += 10 )
+  {
+    overlayValues( t, vals );
+    graph.addData( (float)t / 1000.0f, vals );
+  }
+}
+
+static void benchGraphOverlayTraces()     { drawOverlayTraces( NULL, 0 ); }
+static void benchGraphOverlayTracesBand() { static word band[77 * 4]; drawOverlayTraces( band, 77 * 4 ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// One and a half sweeps with x and y grid and a wide eraser, drawn directly. The line after
+// the scenario compares the erased columns in front of the cursor with the plot redrawn
+// from scratch, the eraser has to leave the grid in place.
+static void benchGraphGrid()
+{
+  CGraph graph(50,40,270,80,0,5,-1,1, &myGLCD);
+  int    cursorX = 51 + (int)( 2.5f / 5.0f * 267.0f );
+  int    match = 0, total = 0;
+  static word        eraser[39][78];
+  static graphSample history[270 - 2];
+
+  graph.setEraserPixelWidth(40);
+  graph.setXGridInterval(0.5f);
+  graph.setYGridInterval(0.25f);
+  graph.setCursor(true);
+  graph.setHistoryBuffer( history, 270 - 2 );
+  graph.redrawAxis();
+
+  for ( unsigned long t = 0; t <= 7500; t += 10 )
+    graph.addData( (float)t / 1000.0f, 0.8f * sin( (float)t * 0.003f ) );
+
+  for ( int x = 0; x < 39; x++ )
+    for ( int y = 0; y < 78; y++ )
+      eraser[x][y] = UTFTSim::getPixel( cursorX + 2 + x, 41 + y );
+
+  // The history is empty in the eraser, the redraw shows background and grid there
+  graph.redrawAxis();
+  for ( int x = 0; x < 39; x++ )
+    for ( int y = 0; y < 78; y++ )
+    {
+      total++;
+      match += ( eraser[x][y] == UTFTSim::getPixel( cursorX + 2 + x, 41 + y ) );
+    }
+  printf( "  grid: %d of %d eraser pixels as redrawn\n", match, total );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// Antialiased uText labels like the ones of the main screen, in three colors. Every
+// edge pixel is looked up in the blend table of uText, rebuilt on each color change.
+static void benchTextAntialiased()
+{
+  static const word colors[3] = { VGA_WHITE, VGA_YELLOW, RGB565( 0, 255, 255 ) };
+  uText txt(&myGLCD, 320, 240);
+
+  txt.setFont(LucidaConsole10a);
+  txt.setBackground(VGA_BLACK);
+  for ( int i = 0; i < 60; i++ )
+  {
+    txt.setForeground( colors[i % 3] );
+    txt.print( 5 + ( i % 3 ) * 100, 10 + ( i / 3 ) * 11, "Ladedr 1,25" );
+  }
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// A strip chart in the columns 50 to 319 of the ILI9341 in landscape, one column per sample.
+// With hardware scrolling every sample draws the column that is about to appear on the
+// right and scrolls by one, the labels left of the strip stay in place. Without it the
+// whole strip is repainted, both end with the same image.
+static const int s_stripX1 = 50, s_stripX2 = 319, s_stripSamples = 300;
+
+static int stripValue( int i )
+{
+  return 120 + (int)( 90.0f * sin( i * 0.05f ) * cos( i * 0.013f ) );
+}
+
+static void drawStripColumn( int x, int i )
+{
+  mySerialGLCD.setColor( 12, 12, 12 );
+  mySerialGLCD.drawVLine( x, 0, 239 );
+  if ( i < 0 )
+    return;
+
+  mySerialGLCD.setColor( 220, 220, 220 );
+  if ( i % 30 == 0 )
+    for ( int y = 0; y < 240; y += 4 )
+      mySerialGLCD.drawPixel( x, y );
+  if ( ( i % 4 ) < 2 )
+    for ( int y = 60; y < 240; y += 60 )
+      mySerialGLCD.drawPixel( x, y );
+
+  mySerialGLCD.setColor( 255, 0, 0 );
+  mySerialGLCD.drawLine( x, stripValue( i - 1 ), x, stripValue( i ) );
+}
+
+static void drawStripLabels()
+{
+  mySerialGLCD.setFont( SmallFont );
+  mySerialGLCD.setColor( 0, 255, 0 );
+  mySerialGLCD.print( (char *)"Strip", 0, 114 );
+}
+
+static void benchStripScroll()
+{
+  int width = s_stripX2 - s_stripX1 + 1;
+
+  drawStripLabels();
+  mySerialGLCD.setScrollArea( s_stripX1, s_stripX2 );
+  for ( int i = 0; i < s_stripSamples; i++ )
+  {
+    // After scrollTo(i + 1) the right edge shows this column
+    drawStripColumn( s_stripX1 + ( width - 1 + i + 1 ) % width, i );
+    mySerialGLCD.scrollTo( i + 1 );
+  }
+}
+
+static void benchStripRepaint()
+{
+  drawStripLabels();
+  for ( int i = 0; i < s_stripSamples; i++ )
+    for ( int x = s_stripX1; x <= s_stripX2; x++ )
+      drawStripColumn( x, i - ( s_stripX2 - x ) );
+}
+
+//---------------------------------------------------------------------------------------------------
+
+// A touch crosshair moved over the dial bitmap. Repainting redraws the dial for every
+// move, the overlay sends the pixels of the old and the new crosshair only: saved in a
+// buffer of 240 pixels, or drawn again through a clip when there is no buffer.
+static const int s_crossX = 100, s_crossY = 60, s_crossMoves = 60;
+
+static void drawDialUnder( void *owner, int x1, int y1, int x2, int y2 )
+{
+  myGLCD.pushClip( x1, y1, x2, y2 );
+  myGLCD.drawPackedBitmap( s_crossX, s_crossY, bmDial );
+  myGLCD.popClip();
+}
+
+static void crossPosition( int i, int *x, int *y )
+{
+  *x = s_crossX + 60 + (int)( 50.0f * sin( i * 0.21f ) );
+  *y = s_crossY + 60 + (int)( 50.0f * cos( i * 0.13f ) );
+}
+
+static void benchCrosshairRepaint()
+{
+  for ( int i = 0; i < s_crossMoves; i++ )
+  {
+    int x, y;
+
+    crossPosition( i, &x, &y );
+    myGLCD.drawPackedBitmap( s_crossX, s_crossY, bmDial );
+    myGLCD.setColor( VGA_YELLOW );
+    myGLCD.drawHLine( s_crossX, y, 119 );
+    myGLCD.drawVLine( x, s_crossY, 119 );
+  }
+}
+
+static void moveCrosshair( word *buffer, int size )
+{
+  COverlay cross( &myGLCD, drawDialUnder, NULL );
+
+  cross.setColor( VGA_YELLOW );
+  cross.setBuffer( buffer, size );
+  myGLCD.drawPackedBitmap( s_crossX, s_crossY, bmDial );
+  for ( int i = 0; i < s_crossMoves; i++ )
+  {
+    int x, y;
+
+    crossPosition( i, &x, &y );
+    cross.showCross( x, y, s_crossX, s_crossY, s_crossX + 119, s_crossY + 119 );
+  }
+}
+
+static void benchCrosshairRedraw()  { moveCrosshair( NULL, 0 ); }
+static void benchCrosshairOverlay() { static word saved[240]; moveCrosshair( saved, 240 ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// Layout changes between two screens of widgets, 6 frames. Drawn directly every widget is
+// visible while it is drawn over the previous screen. In bands through CFrame each band
+// is sent once; on the CPLD module the frame is drawn into the hidden page and shown
+// when complete. Each pair ends with the same image.
+static int s_layout;
+
+static void drawLayout( void *owner, int x1, int y1, int x2, int y2 )
+{
+  UTFT *tft = (UTFT *)owner;
+  int   w   = tft->getDisplayXSize();
+  int   h   = tft->getDisplayYSize();
+  int   gh  = ( h - 60 ) / 2;
+  CGraph       graphA( 0, 20, w / 2, gh, 0, 5, -1, 1, tft );
+  CGraph       graphB( s_layout ? 0 : w / 2, 20 + gh, w / 2, gh, 0, 5, -1, 1, tft );
+  CProgressBar bar( 0, h - 30, w, 16, 0.0f, 100.0f, tft );
+
+  tft->setColor( s_layout ? RGB565( 0, 0, 64 ) : RGB565( 32, 0, 0 ) );
+  tft->fillRect( 0, 0, w - 1, h - 1 );
+  tft->setColor( VGA_GRAY );
+  tft->fillRect( 0, 0, w - 1, 15 );
+  tft->setFont( BigFont );
+  tft->setColor( VGA_WHITE );
+  tft->setBackColor( VGA_TRANSPARENT );
+  tft->print( (char *)( s_layout ? "Temperatures" : "Boost" ), 2, 0 );
+  tft->setBackColor( VGA_BLACK );
+
+  graphA.setYGridInterval( 0.5f );
+  graphB.setLineColor( 0, 255, 0 );
+  graphA.redrawAxis();
+  graphB.redrawAxis();
+  for ( int t = 0; t <= 5000; t += 50 )
+  {
+    graphA.addData( (float)t / 1000.0f, sin( t * ( s_layout ? 0.004f : 0.002f ) ) );
+    graphB.addData( (float)t / 1000.0f, cos( t * 0.003f ) );
+  }
+
+  bar.redraw();
+  bar.update( s_layout ? 35.0f : 80.0f );
+}
+
+static void switchLayouts( UTFT &tft, word *band, int bandSize, boolean frames )
+{
+  CFrame frame( &tft );
+
+  frame.setBandBuffer( band, bandSize );
+  for ( s_layout = 0; s_layout < 6; s_layout++ )
+  {
+    int layout = s_layout;
+
+    s_layout &= 1;
+    if ( frames )
+      frame.draw( drawLayout, &tft );
+    else
+      drawLayout( &tft, 0, 0, tft.getDisplayXSize() - 1, tft.getDisplayYSize() - 1 );
+    s_layout = layout;
+  }
+}
+
+static void beginCPLD()
+{
+  myCPLDGLCD.InitLCD();
+  myCPLDGLCD.clrScr();
+  UTFTSim::resetStats();
+}
+
+static void benchLayoutDirect() { switchLayouts( myGLCD, NULL, 0, false ); }
+static void benchLayoutBand()   { static word band[320 * 8]; switchLayouts( myGLCD, band, 320 * 8, true ); }
+static void benchLayoutCPLDDirect() { switchLayouts( myCPLDGLCD, NULL, 0, false ); }
+static void benchLayoutCPLDPaged()  { switchLayouts( myCPLDGLCD, NULL, 0, true ); }
+
+//---------------------------------------------------------------------------------------------------
+
+// The readouts of loop() plus a long status line, for 2 seconds of 1 ms timer ticks. Drawn
+// directly a loop() pass blocks for all of its text, queued it only formats the numbers and
+// each tick draws about 128 pixels. Both end with the same image.
+static void runReadouts( boolean queued )
+{
+  CRenderQueue  queue( &myGLCD );
+  unsigned long maxPass = 0, maxTick = 0;
+
+  for ( int t = 0; t < 2000; t++ )
+  {
+    unsigned long pixels = UTFTSim::stats.pixels;
+    float         y      = sin( (float)t * 2.0f * (float)(M_PI) / 2000.0f );
+
+    if ( t % 200 == 0 )
+    {
+      char status[16];
+
+      snprintf( status, sizeof(status), "EngRPM %5d", 800 + t * 3 );
+      if ( queued )
+      {
+        queue.setFont( SmallFont );
+        queue.setColor( 0, 255, 0 );
+        queue.printNumF( y, 2, 0, 0, ',', 5, ' ' );
+        queue.setColor( 0, 0, 255 );
+        queue.printNumF( y, 2, 0, 40, ',', 5, ' ' );
+        queue.setFont( BigFont );
+        queue.setColor( 255, 255, 255 );
+        queue.print( status, 0, 200 );
+      }
+      else
+      {
+        myGLCD.setFont( SmallFont );
+        myGLCD.setColor( 0, 255, 0 );
+        myGLCD.printNumF( y, 2, 0, 0, ',', 5, ' ' );
+        myGLCD.setColor( 0, 0, 255 );
+        myGLCD.printNumF( y, 2, 0, 40, ',', 5, ' ' );
+        myGLCD.setFont( BigFont );
+        myGLCD.setColor( 255, 255, 255 );
+        myGLCD.print( status, 0, 200 );
+      }
+      maxPass = max( maxPass, UTFTSim::stats.pixels - pixels );
+    }
+
+    // The timer tick
+    pixels = UTFTSim::stats.pixels;
+    queue.drain( 128 );
+    maxTick = max( maxTick, UTFTSim::stats.pixels - pixels );
+    hostAdvanceMillis( 1 );
+  }
+  queue.flush();
+
+  if ( queued )
+  {
+    const CRenderQueue::stats &st = queue.getStats();
+
+    printf( "  queued: %lu commands, depth max %u, latency avg %lu us max %lu us, %lu slices, pixels per tick max %lu\n",
+            st.done, st.maxDepth, st.sumLatency / max( st.done, 1UL ), st.maxLatency, st.slices, maxTick );
+  }
+  else
+    printf( "  direct: pixels per loop() pass max %lu\n", maxPass );
+}
+
+static void benchReadoutsDirect() { runReadouts( false ); }
+static void benchReadoutsQueued() { runReadouts( true ); }
+
+//---------------------------------------------------------------------------------------------------
+
+typedef struct {
+  const char *name;
+  void (*run)();
+  void (*begin)();      // NULL: clear the screen of myGLCD
+} scenario;
+
+static const scenario s_scenarios[] = {
+  { "lines_pixelwise",    benchLinesPixelwise,    NULL },
+  { "lines_spans",        benchLinesSpans,        NULL },
+  { "main_screen",        benchMainScreen,        NULL },
+  { "main_screen_band",   benchMainScreenBand,    NULL },
+  { "main_screen_list",   benchMainScreenList,    NULL },
+  { "main_screen_dirty",  benchMainScreenDirty,   NULL },
+  { "main_screen_dirty_band", benchMainScreenDirtyBand, NULL },
+  { "primitives_runtime", benchPrimitivesRuntime, NULL },
+  { "primitives_static",  benchPrimitivesStatic,  beginStatic },
+  { "circles_legacy",     benchCirclesLegacy,     NULL },
+  { "circles_spans",      benchCirclesSpans,      NULL },
+  { "circle_costs",       benchCircleCosts,       NULL },
+  { "arcs",               benchArcs,              NULL },
+  { "stream_pixelwise",   benchStreamPixelwise,   NULL },
+  { "stream_write",       benchStreamWrite,       NULL },
+  { "text_legacy",        benchTextLegacy,        NULL },
+  { "text_glyphs",        benchTextGlyphs,        NULL },
+  { "rotated_legacy",     benchRotatedLegacy,     NULL },
+  { "rotated_fixed",      benchRotatedFixed,      NULL },
+  { "bitmaps_raw",        benchBitmapsRaw,        beginBitmapsRaw },
+  { "bitmaps_packed",     benchBitmapsPacked,     NULL },
+  { "primitives_serial",  benchPrimitivesSerial,  beginSerial },
+  { "fills_8bit_legacy",  benchFills8Legacy,      begin8bit },
+  { "fills_8bit",         benchFills8Fast,        begin8bit },
+  { "bar_text_direct",    benchBarTextDirect,     NULL },
+  { "bar_text_band",      benchBarTextBand,       NULL },
+  { "graph_saturated",    benchGraphSaturated,    NULL },
+  { "graph_saturated_band", benchGraphSaturatedBand, NULL },
+  { "graph_saturated_plain", benchGraphSaturatedPlain, NULL },
+  { "graph_history",      benchGraphHistory,      NULL },
+  { "graph_history_band", benchGraphHistoryBand,  NULL },
+  { "graph_spikes",       benchGraphSpikes,       NULL },
+  { "graph_spikes_band",  benchGraphSpikesBand,   NULL },
+  { "graph_autorange",    benchGraphAutoRange,    NULL },
+  { "graph_autorange_band", benchGraphAutoRangeBand, NULL },
+  { "graph_overlay_separate", benchGraphOverlaySeparate, NULL },
+  { "graph_overlay_traces", benchGraphOverlayTraces, NULL },
+  { "graph_overlay_traces_band", benchGraphOverlayTracesBand, NULL },
+  { "graph_grid",         benchGraphGrid,         NULL },
+  { "text_antialiased",   benchTextAntialiased,   NULL },
+  { "strip_repaint",      benchStripRepaint,      beginSerial },
+  { "strip_scroll",       benchStripScroll,       beginSerial },
+  { "crosshair_repaint",  benchCrosshairRepaint,  NULL },
+  { "crosshair_redraw",   benchCrosshairRedraw,   NULL },
+  { "crosshair_overlay",  benchCrosshairOverlay,  NULL },
+  { "layout_direct",      benchLayoutDirect,      NULL },
+  { "layout_band",        benchLayoutBand,        NULL },
+  { "layout_cpld_direct", benchLayoutCPLDDirect,  beginCPLD },
+  { "layout_cpld_paged",  benchLayoutCPLDPaged,   beginCPLD },
+  { "readouts_direct",    benchReadoutsDirect,    NULL },
+  { "readouts_queued",    benchReadoutsQueued,    NULL },
+};
+
+int main( int argc, char **argv )
+{
+  if ( argc > 1 )
+    s_outDir = argv[1];
+
+  myGLCD.InitLCD();
+
+  printf( "%-28s %9s %9s %9s %7s  %-8s %9s\n", "scenario", "commands", "data", "pixels", "cs", "checksum", "usec" );
+
+  for ( unsigned int i = 0; i < sizeof(s_scenarios) / sizeof(s_scenarios[0]); i++ )
+  {
+    if ( s_scenarios[i].begin != NULL )
+      s_scenarios[i].begin();
+    else
+      begin();
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    s_scenarios[i].run();
+    std::chrono::steady_clock::duration took = std::chrono::steady_clock::now() - start;
+    report( s_scenarios[i].name, (long)std::chrono::duration_cast<std::chrono::microseconds>( took ).count() );
+  }
+
+  if ( s_failures > 0 )
+  {
+    printf( "%d checks failed\n", s_failures );
+    return 1;
+  }
+  return 0;
+}
@@ -0,0 +1,332 @@
+// Bitmaps for the host bench, written by lib/UTFT/Tools/bitmap_converter.py
+// from generated test images: a gauge dial, a gradient icon, a two color
+// pattern and a bar with four colors.
+//
+#if defined(__AVR__)
+	#include <avr/pgmspace.h>
+#elif !defined(PROGMEM)
+	#define PROGMEM
+#endif
+
+// dial.ppm: 120x120, 4 bpp, RLE, 1817 bytes (28800 as RGB565)
+const unsigned char bmDial[1817] PROGMEM={
+0x84, 0x78, 0x00, 0x78, 0x00, 0x06, 0x00, 0x00, 0x10, 0x84, 0x29, 0x4B, 0xCE, 0x59, 0xF8, 0x00,
+0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xAB, 0x00, 0x8F, 0x30, 0xE2, 0x00, 0x99, 0x30, 0xD9, 0x00,
+0xA1, 0x30, 0xD2, 0x00, 0x8C, 0x30, 0x8D, 0x10, 0x8C, 0x30, 0xCC, 0x00, 0x89, 0x30, 0x99, 0x10,
+0x89, 0x30, 0xC7, 0x00, 0x87, 0x30, 0xA1, 0x10, 0x87, 0x30, 0xC3, 0x00, 0x87, 0x30, 0xA5, 0x10,
+0x87, 0x30, 0xBF, 0x00, 0x86, 0x30, 0x8E, 0x10, 0x86, 0x20, 0x01, 0x66, 0x84, 0x20, 0x8E, 0x10,
+0x86, 0x30, 0xBB, 0x00, 0x86, 0x30, 0x8B, 0x10, 0x8B, 0x20, 0x01, 0x66, 0x89, 0x20, 0x8B, 0x10,
+0x86, 0x30, 0xB8, 0x00, 0x85, 0x30, 0x89, 0x10, 0x8F, 0x20, 0x01, 0x66, 0x8D, 0x20, 0x89, 0x10,
+0x85, 0x30, 0xB5, 0x00, 0x85, 0x30, 0x88, 0x10, 0x92, 0x20, 0x01, 0x66, 0x90, 0x20, 0x88, 0x10,
+0x85, 0x30, 0xB2, 0x00, 0x84, 0x30, 0x88, 0x10, 0x94, 0x20, 0x01, 0x66, 0x92, 0x20, 0x88, 0x10,
+0x84, 0x30, 0xB0, 0x00, 0x84, 0x30, 0x87, 0x10, 0x01, 0x66, 0x94, 0x20, 0x01, 0x66, 0x94, 0x20,
+0x87, 0x10, 0x84, 0x30, 0xAD, 0x00, 0x84, 0x30, 0x87, 0x10, 0x03, 0x22, 0x66, 0x94, 0x20, 0x01,
+0x66, 0x94, 0x20, 0x01, 0x66, 0x87, 0x10, 0x84, 0x30, 0xAA, 0x00, 0x84, 0x30, 0x86, 0x10, 0x83,
+0x20, 0x82, 0x60, 0x93, 0x20, 0x01, 0x66, 0x94, 0x20, 0x03, 0x66, 0x22, 0x86, 0x10, 0x84, 0x30,
+0xA8, 0x00, 0x84, 0x30, 0x86, 0x10, 0x85, 0x20, 0x01, 0x66, 0x8C, 0x20, 0x8D, 0x10, 0x8E, 0x20,
+0x82, 0x60, 0x82, 0x20, 0x86, 0x10, 0x84, 0x30, 0xA6, 0x00, 0x84, 0x30, 0x85, 0x10, 0x87, 0x20,
+0x82, 0x60, 0x87, 0x20, 0x95, 0x10, 0x8A, 0x20, 0x01, 0x66, 0x85, 0x20, 0x85, 0x10, 0x84, 0x30,
+0xA4, 0x00, 0x83, 0x30, 0x86, 0x10, 0x89, 0x20, 0x01, 0x66, 0x83, 0x20, 0x9D, 0x10, 0x85, 0x20,
+0x01, 0x66, 0x87, 0x20, 0x86, 0x10, 0x83, 0x30, 0xA2, 0x00, 0x83, 0x30, 0x85, 0x10, 0x8B, 0x20,
+0x82, 0x60, 0x00, 0x20, 0xA1, 0x10, 0x83, 0x20, 0x01, 0x66, 0x89, 0x20, 0x85, 0x10, 0x83, 0x30,
+0xA0, 0x00, 0x83, 0x30, 0x85, 0x10, 0x8D, 0x20, 0x00, 0x60, 0xA5, 0x10, 0x02, 0x26, 0x60, 0x8B,
+0x20, 0x85, 0x10, 0x83, 0x30, 0x9E, 0x00, 0x83, 0x30, 0x85, 0x10, 0x8D, 0x20, 0xA9, 0x10, 0x00,
+0x60, 0x8C, 0x20, 0x85, 0x10, 0x83, 0x30, 0x9C, 0x00, 0x83, 0x30, 0x85, 0x10, 0x8C, 0x20, 0xAD,
+0x10, 0x8C, 0x20, 0x85, 0x10, 0x83, 0x30, 0x9B, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8B, 0x20, 0xB1,
+0x10, 0x8B, 0x20, 0x84, 0x10, 0x83, 0x30, 0x9A, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8B, 0x20, 0xB3,
+0x10, 0x8B, 0x20, 0x84, 0x10, 0x83, 0x30, 0x98, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8B, 0x20, 0xB5,
+0x10, 0x8B, 0x20, 0x84, 0x10, 0x83, 0x30, 0x96, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8A, 0x20, 0xB9,
+0x10, 0x8A, 0x20, 0x84, 0x10, 0x83, 0x30, 0x95, 0x00, 0x82, 0x30, 0x84, 0x10, 0x8A, 0x20, 0xBB,
+0x10, 0x8A, 0x20, 0x84, 0x10, 0x82, 0x30, 0x94, 0x00, 0x83, 0x30, 0x84, 0x10, 0x00, 0x60, 0x88,
+0x20, 0xBD, 0x10, 0x89, 0x20, 0x84, 0x10, 0x83, 0x30, 0x92, 0x00, 0x83, 0x30, 0x84, 0x10, 0x83,
+0x60, 0x85, 0x20, 0xBF, 0x10, 0x89, 0x20, 0x84, 0x10, 0x83, 0x30, 0x91, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x01, 0x22, 0x83, 0x60, 0x83, 0x20, 0xC1, 0x10, 0x87, 0x20, 0x01, 0x66, 0x84, 0x10, 0x82,
+0x30, 0x90, 0x00, 0x83, 0x30, 0x84, 0x10, 0x83, 0x20, 0x82, 0x60, 0x01, 0x22, 0xC3, 0x10, 0x84,
+0x20, 0x83, 0x60, 0x84, 0x10, 0x83, 0x30, 0x8F, 0x00, 0x82, 0x30, 0x84, 0x10, 0x85, 0x20, 0x82,
+0x60, 0x00, 0x20, 0xC3, 0x10, 0x83, 0x20, 0x83, 0x60, 0x01, 0x22, 0x84, 0x10, 0x82, 0x30, 0x8E,
+0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0x00, 0x60, 0xC5, 0x10, 0x00, 0x20, 0x83, 0x60, 0x84,
+0x20, 0x83, 0x10, 0x83, 0x30, 0x8D, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xC7, 0x10, 0x82,
+0x60, 0x85, 0x20, 0x84, 0x10, 0x82, 0x30, 0x8C, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xC9,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x83, 0x30, 0x8B, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xC9,
+0x10, 0x88, 0x20, 0x84, 0x10, 0x82, 0x30, 0x8A, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCB,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x83, 0x30, 0x89, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xCB,
+0x10, 0x88, 0x20, 0x84, 0x10, 0x82, 0x30, 0x89, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCD,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x82, 0x30, 0x88, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCD,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x83, 0x30, 0x87, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCF,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x82, 0x30, 0x87, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCF,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x82, 0x30, 0x86, 0x00, 0x82, 0x30, 0x84, 0x10, 0x87, 0x20, 0xD1,
+0x10, 0x87, 0x20, 0x84, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xD1,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD3,
+0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD3,
+0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x84, 0x00, 0x82, 0x30, 0x84, 0x10, 0x87, 0x20, 0xD3,
+0x10, 0x87, 0x20, 0x84, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xD3,
+0x10, 0x88, 0x20, 0x83, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD5,
+0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x83, 0x60, 0x83,
+0x20, 0xD5, 0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87,
+0x60, 0xD5, 0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x82, 0x00, 0x83, 0x30, 0x83, 0x10, 0x83,
+0x20, 0x83, 0x60, 0xD5, 0x10, 0x83, 0x20, 0x83, 0x60, 0x83, 0x10, 0x83, 0x30, 0x01, 0x00, 0x82,
+0x30, 0x83, 0x10, 0x87, 0x20, 0xD7, 0x10, 0x87, 0x60, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82,
+0x30, 0x83, 0x10, 0x87, 0x20, 0xA9, 0x10, 0x83, 0x50, 0xA9, 0x10, 0x83, 0x60, 0x83, 0x20, 0x83,
+0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA7, 0x10, 0x87, 0x50, 0xA7,
+0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6,
+0x10, 0x89, 0x50, 0xA6, 0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xA6, 0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA5, 0x10, 0x8B, 0x50, 0xA5, 0x10, 0x87, 0x20, 0x83,
+0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA5, 0x10, 0x8B, 0x50, 0xA5,
+0x10, 0x87, 0x20, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA5,
+0x10, 0x8B, 0x50, 0xA5, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x87, 0x20, 0xA5, 0x10, 0x8B, 0x50, 0xA5, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xA6, 0x10, 0x87, 0x40, 0x83,
+0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xA6,
+0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA7,
+0x10, 0x87, 0x50, 0xA7, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x87, 0x20, 0xA9, 0x10, 0x83, 0x50, 0xA9, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD7, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x83, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD5, 0x10, 0x87, 0x40, 0x83, 0x10, 0x83, 0x30, 0x82,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD5, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x83,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD5, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x83,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xD5, 0x10, 0x87, 0x40, 0x83, 0x10, 0x82, 0x30, 0x83,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xD3, 0x10, 0x88, 0x40, 0x83, 0x10, 0x82, 0x30, 0x83,
+0x00, 0x82, 0x30, 0x84, 0x10, 0x84, 0x20, 0x82, 0x60, 0xD3, 0x10, 0x87, 0x40, 0x84, 0x10, 0x82,
+0x30, 0x84, 0x00, 0x82, 0x30, 0x83, 0x10, 0x00, 0x20, 0x86, 0x60, 0xD3, 0x10, 0x87, 0x40, 0x83,
+0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x84, 0x60, 0x82, 0x20, 0xD3, 0x10, 0x87,
+0x40, 0x83, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x01, 0x66, 0x86, 0x20, 0xD1,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x84, 0x10, 0x87, 0x20, 0xD1,
+0x10, 0x87, 0x40, 0x84, 0x10, 0x82, 0x30, 0x86, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCF,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x82, 0x30, 0x87, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCF,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x82, 0x30, 0x87, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCD,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x83, 0x30, 0x88, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCD,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x82, 0x30, 0x89, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xCB,
+0x10, 0x88, 0x40, 0x84, 0x10, 0x82, 0x30, 0x89, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xCB,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x83, 0x30, 0x8A, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xC9,
+0x10, 0x88, 0x40, 0x84, 0x10, 0x82, 0x30, 0x8B, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xC9,
+0x10, 0x88, 0x40, 0x83, 0x10, 0x83, 0x30, 0x8C, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xC7,
+0x10, 0x88, 0x40, 0x84, 0x10, 0x82, 0x30, 0x8D, 0x00, 0x83, 0x30, 0x83, 0x10, 0x89, 0x20, 0xC5,
+0x10, 0x89, 0x40, 0x83, 0x10, 0x83, 0x30, 0x8E, 0x00, 0x82, 0x30, 0x84, 0x10, 0x89, 0x20, 0xC3,
+0x10, 0x89, 0x40, 0x84, 0x10, 0x82, 0x30, 0x8F, 0x00, 0x83, 0x30, 0x84, 0x10, 0x88, 0x20, 0xC3,
+0x10, 0x88, 0x40, 0x84, 0x10, 0x83, 0x30, 0x90, 0x00, 0x82, 0x30, 0x84, 0x10, 0x89, 0x20, 0xC1,
+0x10, 0x89, 0x40, 0x84, 0x10, 0x82, 0x30, 0x91, 0x00, 0x83, 0x30, 0x84, 0x10, 0x88, 0x20, 0x00,
+0x60, 0xBF, 0x10, 0x89, 0x40, 0x84, 0x10, 0x83, 0x30, 0x92, 0x00, 0x83, 0x30, 0x84, 0x10, 0x86,
+0x20, 0x82, 0x60, 0xBD, 0x10, 0x89, 0x40, 0x84, 0x10, 0x83, 0x30, 0x94, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x85, 0x20, 0x82, 0x60, 0xBF, 0x10, 0x88, 0x40, 0x84, 0x10, 0x82, 0x30, 0x95, 0x00, 0x83,
+0x30, 0x84, 0x10, 0x82, 0x20, 0x83, 0x60, 0xC1, 0x10, 0x86, 0x40, 0x84, 0x10, 0x83, 0x30, 0x96,
+0x00, 0x83, 0x30, 0x84, 0x10, 0x00, 0x20, 0x83, 0x60, 0xC3, 0x10, 0x84, 0x40, 0x84, 0x10, 0x83,
+0x30, 0x98, 0x00, 0x83, 0x30, 0x84, 0x10, 0x82, 0x60, 0xC5, 0x10, 0x82, 0x40, 0x84, 0x10, 0x83,
+0x30, 0x9A, 0x00, 0x83, 0x30, 0x84, 0x10, 0x00, 0x60, 0xC7, 0x10, 0x00, 0x40, 0x84, 0x10, 0x83,
+0x30, 0x9B, 0x00, 0x83, 0x30, 0xD3, 0x10, 0x83, 0x30, 0x9C, 0x00, 0x83, 0x30, 0xD1, 0x10, 0x83,
+0x30, 0x9E, 0x00, 0x83, 0x30, 0xCF, 0x10, 0x83, 0x30, 0xA0, 0x00, 0x83, 0x30, 0xCD, 0x10, 0x83,
+0x30, 0xA2, 0x00, 0x83, 0x30, 0xCB, 0x10, 0x83, 0x30, 0xA4, 0x00, 0x84, 0x30, 0xC7, 0x10, 0x84,
+0x30, 0xA6, 0x00, 0x84, 0x30, 0xC5, 0x10, 0x84, 0x30, 0xA8, 0x00, 0x84, 0x30, 0xC3, 0x10, 0x84,
+0x30, 0xAA, 0x00, 0x84, 0x30, 0xC1, 0x10, 0x84, 0x30, 0xAD, 0x00, 0x84, 0x30, 0xBD, 0x10, 0x84,
+0x30, 0xB0, 0x00, 0x84, 0x30, 0xBB, 0x10, 0x84, 0x30, 0xB2, 0x00, 0x85, 0x30, 0xB7, 0x10, 0x85,
+0x30, 0xB5, 0x00, 0x85, 0x30, 0xB3, 0x10, 0x85, 0x30, 0xB8, 0x00, 0x86, 0x30, 0xAF, 0x10, 0x86,
+0x30, 0xBB, 0x00, 0x86, 0x30, 0xAB, 0x10, 0x86, 0x30, 0xBF, 0x00, 0x87, 0x30, 0xA5, 0x10, 0x87,
+0x30, 0xC3, 0x00, 0x87, 0x30, 0xA1, 0x10, 0x87, 0x30, 0xC7, 0x00, 0x89, 0x30, 0x99, 0x10, 0x89,
+0x30, 0xCC, 0x00, 0x8C, 0x30, 0x8D, 0x10, 0x8C, 0x30, 0xD2, 0x00, 0xA1, 0x30, 0xD9, 0x00, 0x99,
+0x30, 0xE2, 0x00, 0x8F, 0x30, 0xFF, 0x00, 0xAB, 0x00,
+};
+
+
+// dial.ppm: 120x120, 4 bpp, RLE, landscape order, 1698 bytes (28800 as RGB565)
+const unsigned char bmDialLandscape[1698] PROGMEM={
+0xC4, 0x78, 0x00, 0x78, 0x00, 0x06, 0x00, 0x00, 0x10, 0x84, 0x29, 0x4B, 0xCE, 0x59, 0xF8, 0x00,
+0xFD, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0xAB, 0x00, 0x8F, 0x30, 0xE2, 0x00, 0x99, 0x30, 0xD9, 0x00,
+0xA1, 0x30, 0xD2, 0x00, 0x8C, 0x30, 0x8D, 0x10, 0x8C, 0x30, 0xCC, 0x00, 0x89, 0x30, 0x99, 0x10,
+0x89, 0x30, 0xC7, 0x00, 0x87, 0x30, 0xA1, 0x10, 0x87, 0x30, 0xC3, 0x00, 0x87, 0x30, 0xA5, 0x10,
+0x87, 0x30, 0xBF, 0x00, 0x86, 0x30, 0x8E, 0x10, 0x00, 0x60, 0x85, 0x20, 0x86, 0x40, 0x8E, 0x10,
+0x86, 0x30, 0xBB, 0x00, 0x86, 0x30, 0x8B, 0x10, 0x83, 0x20, 0x01, 0x66, 0x85, 0x20, 0x8B, 0x40,
+0x8B, 0x10, 0x86, 0x30, 0xB8, 0x00, 0x85, 0x30, 0x89, 0x10, 0x87, 0x20, 0x01, 0x66, 0x85, 0x20,
+0x8F, 0x40, 0x89, 0x10, 0x85, 0x30, 0xB5, 0x00, 0x85, 0x30, 0x88, 0x10, 0x8A, 0x20, 0x01, 0x66,
+0x85, 0x20, 0x92, 0x40, 0x88, 0x10, 0x85, 0x30, 0xB2, 0x00, 0x84, 0x30, 0x88, 0x10, 0x8C, 0x20,
+0x82, 0x60, 0x84, 0x20, 0x94, 0x40, 0x88, 0x10, 0x84, 0x30, 0xB0, 0x00, 0x84, 0x30, 0x87, 0x10,
+0x8F, 0x20, 0x01, 0x66, 0x84, 0x20, 0x96, 0x40, 0x87, 0x10, 0x84, 0x30, 0xAD, 0x00, 0x84, 0x30,
+0x87, 0x10, 0x91, 0x20, 0x01, 0x66, 0x84, 0x20, 0x98, 0x40, 0x87, 0x10, 0x84, 0x30, 0xAA, 0x00,
+0x84, 0x30, 0x86, 0x10, 0x93, 0x20, 0x01, 0x66, 0x84, 0x20, 0x9A, 0x40, 0x86, 0x10, 0x84, 0x30,
+0xA8, 0x00, 0x84, 0x30, 0x86, 0x10, 0x94, 0x20, 0x8D, 0x10, 0x94, 0x40, 0x86, 0x10, 0x84, 0x30,
+0xA6, 0x00, 0x84, 0x30, 0x85, 0x10, 0x01, 0x66, 0x90, 0x20, 0x95, 0x10, 0x92, 0x40, 0x85, 0x10,
+0x84, 0x30, 0xA4, 0x00, 0x83, 0x30, 0x86, 0x10, 0x00, 0x20, 0x82, 0x60, 0x8B, 0x20, 0x9D, 0x10,
+0x8F, 0x40, 0x86, 0x10, 0x83, 0x30, 0xA2, 0x00, 0x83, 0x30, 0x85, 0x10, 0x83, 0x20, 0x01, 0x66,
+0x89, 0x20, 0xA1, 0x10, 0x8F, 0x40, 0x85, 0x10, 0x83, 0x30, 0xA0, 0x00, 0x83, 0x30, 0x85, 0x10,
+0x84, 0x20, 0x82, 0x60, 0x86, 0x20, 0xA5, 0x10, 0x8E, 0x40, 0x85, 0x10, 0x83, 0x30, 0x9E, 0x00,
+0x83, 0x30, 0x85, 0x10, 0x86, 0x20, 0x82, 0x60, 0x83, 0x20, 0xA9, 0x10, 0x8D, 0x40, 0x85, 0x10,
+0x83, 0x30, 0x9C, 0x00, 0x83, 0x30, 0x85, 0x10, 0x88, 0x20, 0x03, 0x66, 0x22, 0xAD, 0x10, 0x8C,
+0x40, 0x85, 0x10, 0x83, 0x30, 0x9B, 0x00, 0x83, 0x30, 0x84, 0x10, 0x89, 0x20, 0x01, 0x66, 0xB1,
+0x10, 0x8B, 0x40, 0x84, 0x10, 0x83, 0x30, 0x9A, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8B, 0x20, 0xB3,
+0x10, 0x89, 0x40, 0x86, 0x10, 0x83, 0x30, 0x98, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8B, 0x20, 0xB5,
+0x10, 0x87, 0x40, 0x88, 0x10, 0x83, 0x30, 0x96, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8A, 0x20, 0xB9,
+0x10, 0x84, 0x40, 0x8A, 0x10, 0x83, 0x30, 0x95, 0x00, 0x82, 0x30, 0x84, 0x10, 0x8A, 0x20, 0xBB,
+0x10, 0x82, 0x40, 0x8C, 0x10, 0x82, 0x30, 0x94, 0x00, 0x83, 0x30, 0x84, 0x10, 0x89, 0x20, 0xBD,
+0x10, 0x00, 0x40, 0x8D, 0x10, 0x83, 0x30, 0x92, 0x00, 0x83, 0x30, 0x84, 0x10, 0x89, 0x20, 0xCE,
+0x10, 0x83, 0x30, 0x91, 0x00, 0x82, 0x30, 0x84, 0x10, 0x89, 0x20, 0xD0, 0x10, 0x82, 0x30, 0x90,
+0x00, 0x83, 0x30, 0x84, 0x10, 0x88, 0x20, 0xD1, 0x10, 0x83, 0x30, 0x8F, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x89, 0x20, 0xD2, 0x10, 0x82, 0x30, 0x8E, 0x00, 0x83, 0x30, 0x83, 0x10, 0x89, 0x20, 0xD3,
+0x10, 0x83, 0x30, 0x8D, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xD5, 0x10, 0x82, 0x30, 0x8C,
+0x00, 0x83, 0x30, 0x83, 0x10, 0x82, 0x60, 0x85, 0x20, 0xD6, 0x10, 0x83, 0x30, 0x8B, 0x00, 0x82,
+0x30, 0x84, 0x10, 0x83, 0x60, 0x84, 0x20, 0xD7, 0x10, 0x82, 0x30, 0x8A, 0x00, 0x83, 0x30, 0x83,
+0x10, 0x82, 0x20, 0x83, 0x60, 0x01, 0x22, 0xD8, 0x10, 0x83, 0x30, 0x89, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x84, 0x20, 0x83, 0x60, 0xD9, 0x10, 0x82, 0x30, 0x89, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87,
+0x20, 0x00, 0x60, 0xDA, 0x10, 0x82, 0x30, 0x88, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xDA,
+0x10, 0x83, 0x30, 0x87, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xDC, 0x10, 0x82, 0x30, 0x87,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xDC, 0x10, 0x82, 0x30, 0x86, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x87, 0x20, 0xDE, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xDE,
+0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xDF, 0x10, 0x82, 0x30, 0x85,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xDF, 0x10, 0x82, 0x30, 0x84, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x87, 0x20, 0xE0, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xE0,
+0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE1, 0x10, 0x82, 0x30, 0x83,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE1, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x87, 0x20, 0xE1, 0x10, 0x82, 0x30, 0x82, 0x00, 0x83, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE1,
+0x10, 0x83, 0x30, 0x01, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE3, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA9, 0x10, 0x83, 0x50, 0xB5, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA7, 0x10, 0x87, 0x50, 0xB3, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xB2, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xB2, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x60, 0xA5, 0x10, 0x8B, 0x50, 0xB1, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x60, 0xA5, 0x10, 0x8B, 0x50, 0xB1, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA5, 0x10, 0x8B, 0x50, 0xB1, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA5, 0x10, 0x8B, 0x50, 0xB1, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xB2, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA6, 0x10, 0x89, 0x50, 0xB2, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA7, 0x10, 0x87, 0x50, 0xB3, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xA9, 0x10, 0x83, 0x50, 0xB5, 0x10, 0x82, 0x30, 0x01,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE3, 0x10, 0x82, 0x30, 0x01, 0x00, 0x83, 0x30, 0x83,
+0x10, 0x87, 0x20, 0xE1, 0x10, 0x83, 0x30, 0x82, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE1,
+0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE1, 0x10, 0x82, 0x30, 0x83,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xE1, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x88, 0x20, 0xE0, 0x10, 0x82, 0x30, 0x83, 0x00, 0x82, 0x30, 0x84, 0x10, 0x87, 0x20, 0xE0,
+0x10, 0x82, 0x30, 0x84, 0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xDF, 0x10, 0x82, 0x30, 0x85,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0xDF, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x88, 0x20, 0xDE, 0x10, 0x82, 0x30, 0x85, 0x00, 0x82, 0x30, 0x84, 0x10, 0x87, 0x20, 0xDE,
+0x10, 0x82, 0x30, 0x86, 0x00, 0x82, 0x30, 0x83, 0x10, 0x88, 0x20, 0xDC, 0x10, 0x82, 0x30, 0x87,
+0x00, 0x82, 0x30, 0x83, 0x10, 0x87, 0x20, 0x00, 0x60, 0xDC, 0x10, 0x82, 0x30, 0x87, 0x00, 0x83,
+0x30, 0x83, 0x10, 0x84, 0x20, 0x83, 0x60, 0xDA, 0x10, 0x83, 0x30, 0x88, 0x00, 0x82, 0x30, 0x83,
+0x10, 0x82, 0x20, 0x84, 0x60, 0x00, 0x20, 0xDA, 0x10, 0x82, 0x30, 0x89, 0x00, 0x82, 0x30, 0x84,
+0x10, 0x84, 0x60, 0x83, 0x20, 0xD9, 0x10, 0x82, 0x30, 0x89, 0x00, 0x83, 0x30, 0x83, 0x10, 0x82,
+0x60, 0x85, 0x20, 0xD8, 0x10, 0x83, 0x30, 0x8A, 0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xD7,
+0x10, 0x82, 0x30, 0x8B, 0x00, 0x83, 0x30, 0x83, 0x10, 0x88, 0x20, 0xD6, 0x10, 0x83, 0x30, 0x8C,
+0x00, 0x82, 0x30, 0x84, 0x10, 0x88, 0x20, 0xD5, 0x10, 0x82, 0x30, 0x8D, 0x00, 0x83, 0x30, 0x83,
+0x10, 0x89, 0x20, 0xD3, 0x10, 0x83, 0x30, 0x8E, 0x00, 0x82, 0x30, 0x84, 0x10, 0x89, 0x20, 0xD2,
+0x10, 0x82, 0x30, 0x8F, 0x00, 0x83, 0x30, 0x84, 0x10, 0x88, 0x20, 0xD1, 0x10, 0x83, 0x30, 0x90,
+0x00, 0x82, 0x30, 0x84, 0x10, 0x89, 0x20, 0xD0, 0x10, 0x82, 0x30, 0x91, 0x00, 0x83, 0x30, 0x84,
+0x10, 0x89, 0x20, 0xCE, 0x10, 0x83, 0x30, 0x92, 0x00, 0x83, 0x30, 0x84, 0x10, 0x89, 0x20, 0xBD,
+0x10, 0x00, 0x60, 0x8D, 0x10, 0x83, 0x30, 0x94, 0x00, 0x82, 0x30, 0x84, 0x10, 0x8A, 0x20, 0xBB,
+0x10, 0x82, 0x60, 0x8C, 0x10, 0x82, 0x30, 0x95, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8A, 0x20, 0xB9,
+0x10, 0x01, 0x22, 0x82, 0x60, 0x8A, 0x10, 0x83, 0x30, 0x96, 0x00, 0x83, 0x30, 0x84, 0x10, 0x8B,
+0x20, 0xB5, 0x10, 0x84, 0x20, 0x82, 0x60, 0x88, 0x10, 0x83, 0x30, 0x98, 0x00, 0x83, 0x30, 0x84,
+0x10, 0x89, 0x20, 0x01, 0x66, 0xB3, 0x10, 0x86, 0x20, 0x82, 0x60, 0x86, 0x10, 0x83, 0x30, 0x9A,
+0x00, 0x83, 0x30, 0x84, 0x10, 0x87, 0x20, 0x03, 0x66, 0x22, 0xB1, 0x10, 0x87, 0x20, 0x83, 0x60,
+0x84, 0x10, 0x83, 0x30, 0x9B, 0x00, 0x83, 0x30, 0x85, 0x10, 0x85, 0x20, 0x82, 0x60, 0x83, 0x20,
+0xAD, 0x10, 0x8A, 0x20, 0x01, 0x66, 0x85, 0x10, 0x83, 0x30, 0x9C, 0x00, 0x83, 0x30, 0x85, 0x10,
+0x83, 0x20, 0x82, 0x60, 0x86, 0x20, 0xA9, 0x10, 0x8D, 0x20, 0x85, 0x10, 0x83, 0x30, 0x9E, 0x00,
+0x83, 0x30, 0x85, 0x10, 0x82, 0x20, 0x01, 0x66, 0x89, 0x20, 0xA5, 0x10, 0x8E, 0x20, 0x85, 0x10,
+0x83, 0x30, 0xA0, 0x00, 0x83, 0x30, 0x85, 0x10, 0x00, 0x20, 0x82, 0x60, 0x8B, 0x20, 0xA1, 0x10,
+0x8F, 0x20, 0x85, 0x10, 0x83, 0x30, 0xA2, 0x00, 0x83, 0x30, 0x86, 0x10, 0x00, 0x60, 0x8E, 0x20,
+0x9D, 0x10, 0x8F, 0x20, 0x86, 0x10, 0x83, 0x30, 0xA4, 0x00, 0x84, 0x30, 0x85, 0x10, 0x92, 0x20,
+0x95, 0x10, 0x02, 0x26, 0x60, 0x8F, 0x20, 0x85, 0x10, 0x84, 0x30, 0xA6, 0x00, 0x84, 0x30, 0x86,
+0x10, 0x92, 0x20, 0x01, 0x66, 0x8D, 0x10, 0x84, 0x20, 0x01, 0x66, 0x8D, 0x20, 0x86, 0x10, 0x84,
+0x30, 0xA8, 0x00, 0x84, 0x30, 0x86, 0x10, 0x91, 0x20, 0x01, 0x66, 0x92, 0x20, 0x01, 0x66, 0x8C,
+0x20, 0x86, 0x10, 0x84, 0x30, 0xAA, 0x00, 0x84, 0x30, 0x87, 0x10, 0x8F, 0x20, 0x01, 0x66, 0x93,
+0x20, 0x01, 0x66, 0x89, 0x20, 0x87, 0x10, 0x84, 0x30, 0xAD, 0x00, 0x84, 0x30, 0x87, 0x10, 0x8D,
+0x20, 0x01, 0x66, 0x93, 0x20, 0x01, 0x66, 0x87, 0x20, 0x87, 0x10, 0x84, 0x30, 0xB0, 0x00, 0x84,
+0x30, 0x88, 0x10, 0x8A, 0x20, 0x01, 0x66, 0x94, 0x20, 0x01, 0x66, 0x85, 0x20, 0x88, 0x10, 0x84,
+0x30, 0xB2, 0x00, 0x85, 0x30, 0x88, 0x10, 0x88, 0x20, 0x01, 0x66, 0x94, 0x20, 0x82, 0x60, 0x82,
+0x20, 0x88, 0x10, 0x85, 0x30, 0xB5, 0x00, 0x85, 0x30, 0x89, 0x10, 0x85, 0x20, 0x01, 0x66, 0x95,
+0x20, 0x01, 0x66, 0x89, 0x10, 0x85, 0x30, 0xB8, 0x00, 0x86, 0x30, 0x8B, 0x10, 0x03, 0x22, 0x66,
+0x93, 0x20, 0x8B, 0x10, 0x86, 0x30, 0xBB, 0x00, 0x86, 0x30, 0x8E, 0x10, 0x8D, 0x20, 0x8E, 0x10,
+0x86, 0x30, 0xBF, 0x00, 0x87, 0x30, 0xA5, 0x10, 0x87, 0x30, 0xC3, 0x00, 0x87, 0x30, 0xA1, 0x10,
+0x87, 0x30, 0xC7, 0x00, 0x89, 0x30, 0x99, 0x10, 0x89, 0x30, 0xCC, 0x00, 0x8C, 0x30, 0x8D, 0x10,
+0x8C, 0x30, 0xD2, 0x00, 0xA1, 0x30, 0xD9, 0x00, 0x99, 0x30, 0xE2, 0x00, 0x8F, 0x30, 0xFF, 0x00,
+0xAB, 0x00,
+};
+
+
+// icon.ppm: 32x32, 8 bpp, RLE, 436 bytes (2048 as RGB565)
+const unsigned char bmIcon[436] PROGMEM={
+0x88, 0x20, 0x00, 0x20, 0x00, 0x28, 0x00, 0x00, 0x03, 0x10, 0x04, 0x10, 0x22, 0x10, 0x23, 0x10,
+0x24, 0x10, 0x25, 0x10, 0x41, 0x10, 0x42, 0x10, 0x43, 0x10, 0x44, 0x10, 0x45, 0x10, 0x46, 0x10,
+0x60, 0x10, 0x61, 0x10, 0x62, 0x10, 0x63, 0x10, 0x64, 0x10, 0x65, 0x10, 0x66, 0x10, 0x67, 0x10,
+0x80, 0x10, 0x81, 0x10, 0x82, 0x10, 0x83, 0x10, 0x84, 0x10, 0x85, 0x10, 0x86, 0x10, 0x87, 0x10,
+0xA1, 0x10, 0xA2, 0x10, 0xA3, 0x10, 0xA4, 0x10, 0xA5, 0x10, 0xA6, 0x10, 0xC2, 0x10, 0xC3, 0x10,
+0xC4, 0x10, 0xC5, 0x10, 0xE3, 0x10, 0xE4, 0x10, 0xAE, 0x00, 0x01, 0x0D, 0x15, 0x9C, 0x00, 0x81,
+0x0D, 0x81, 0x15, 0x9A, 0x00, 0x82, 0x0D, 0x82, 0x15, 0x98, 0x00, 0x83, 0x0E, 0x83, 0x16, 0x96,
+0x00, 0x00, 0x07, 0x83, 0x0E, 0x83, 0x16, 0x00, 0x1D, 0x94, 0x00, 0x81, 0x07, 0x83, 0x0E, 0x83,
+0x16, 0x81, 0x1D, 0x92, 0x00, 0x82, 0x07, 0x83, 0x0E, 0x83, 0x16, 0x82, 0x1D, 0x90, 0x00, 0x83,
+0x08, 0x83, 0x0F, 0x83, 0x17, 0x83, 0x1E, 0x8E, 0x00, 0x00, 0x03, 0x83, 0x08, 0x83, 0x0F, 0x83,
+0x17, 0x83, 0x1E, 0x00, 0x23, 0x8C, 0x00, 0x81, 0x03, 0x83, 0x08, 0x83, 0x0F, 0x83, 0x17, 0x83,
+0x1E, 0x81, 0x23, 0x8A, 0x00, 0x82, 0x03, 0x83, 0x08, 0x83, 0x0F, 0x83, 0x17, 0x83, 0x1E, 0x82,
+0x23, 0x88, 0x00, 0x83, 0x04, 0x83, 0x09, 0x83, 0x10, 0x83, 0x18, 0x83, 0x1F, 0x83, 0x24, 0x86,
+0x00, 0x00, 0x01, 0x83, 0x04, 0x83, 0x09, 0x83, 0x10, 0x83, 0x18, 0x83, 0x1F, 0x83, 0x24, 0x00,
+0x27, 0x84, 0x00, 0x81, 0x01, 0x83, 0x04, 0x83, 0x09, 0x83, 0x10, 0x83, 0x18, 0x83, 0x1F, 0x83,
+0x24, 0x81, 0x27, 0x82, 0x00, 0x82, 0x01, 0x83, 0x04, 0x83, 0x09, 0x83, 0x10, 0x83, 0x18, 0x83,
+0x1F, 0x83, 0x24, 0x82, 0x27, 0x81, 0x00, 0x82, 0x02, 0x83, 0x05, 0x83, 0x0A, 0x83, 0x11, 0x83,
+0x19, 0x83, 0x20, 0x83, 0x25, 0x82, 0x28, 0x82, 0x00, 0x81, 0x02, 0x83, 0x05, 0x83, 0x0A, 0x83,
+0x11, 0x83, 0x19, 0x83, 0x20, 0x83, 0x25, 0x81, 0x28, 0x84, 0x00, 0x00, 0x02, 0x83, 0x05, 0x83,
+0x0A, 0x83, 0x11, 0x83, 0x19, 0x83, 0x20, 0x83, 0x25, 0x00, 0x28, 0x86, 0x00, 0x83, 0x05, 0x83,
+0x0A, 0x83, 0x11, 0x83, 0x19, 0x83, 0x20, 0x83, 0x25, 0x88, 0x00, 0x82, 0x06, 0x83, 0x0B, 0x83,
+0x12, 0x83, 0x1A, 0x83, 0x21, 0x82, 0x26, 0x8A, 0x00, 0x81, 0x06, 0x83, 0x0B, 0x83, 0x12, 0x83,
+0x1A, 0x83, 0x21, 0x81, 0x26, 0x8C, 0x00, 0x00, 0x06, 0x83, 0x0B, 0x83, 0x12, 0x83, 0x1A, 0x83,
+0x21, 0x00, 0x26, 0x8E, 0x00, 0x83, 0x0B, 0x83, 0x12, 0x83, 0x1A, 0x83, 0x21, 0x90, 0x00, 0x82,
+0x0C, 0x83, 0x13, 0x83, 0x1B, 0x82, 0x22, 0x92, 0x00, 0x81, 0x0C, 0x83, 0x13, 0x83, 0x1B, 0x81,
+0x22, 0x94, 0x00, 0x00, 0x0C, 0x83, 0x13, 0x83, 0x1B, 0x00, 0x22, 0x96, 0x00, 0x83, 0x13, 0x83,
+0x1B, 0x98, 0x00, 0x82, 0x14, 0x82, 0x1C, 0x9A, 0x00, 0x81, 0x14, 0x81, 0x1C, 0x9C, 0x00, 0x01,
+0x14, 0x1C, 0xAE, 0x00,
+};
+
+
+// icon.ppm: 32x32, 16 bpp, RLE, 528 bytes (2048 as RGB565)
+const unsigned char bmIcon16[528] PROGMEM={
+0x90, 0x20, 0x00, 0x20, 0x00, 0xAE, 0x00, 0x00, 0x01, 0x60, 0x10, 0x80, 0x10, 0x9C, 0x00, 0x00,
+0x81, 0x60, 0x10, 0x81, 0x80, 0x10, 0x9A, 0x00, 0x00, 0x82, 0x60, 0x10, 0x82, 0x80, 0x10, 0x98,
+0x00, 0x00, 0x83, 0x61, 0x10, 0x83, 0x81, 0x10, 0x96, 0x00, 0x00, 0x00, 0x41, 0x10, 0x83, 0x61,
+0x10, 0x83, 0x81, 0x10, 0x00, 0xA1, 0x10, 0x94, 0x00, 0x00, 0x81, 0x41, 0x10, 0x83, 0x61, 0x10,
+0x83, 0x81, 0x10, 0x81, 0xA1, 0x10, 0x92, 0x00, 0x00, 0x82, 0x41, 0x10, 0x83, 0x61, 0x10, 0x83,
+0x81, 0x10, 0x82, 0xA1, 0x10, 0x90, 0x00, 0x00, 0x83, 0x42, 0x10, 0x83, 0x62, 0x10, 0x83, 0x82,
+0x10, 0x83, 0xA2, 0x10, 0x8E, 0x00, 0x00, 0x00, 0x22, 0x10, 0x83, 0x42, 0x10, 0x83, 0x62, 0x10,
+0x83, 0x82, 0x10, 0x83, 0xA2, 0x10, 0x00, 0xC2, 0x10, 0x8C, 0x00, 0x00, 0x81, 0x22, 0x10, 0x83,
+0x42, 0x10, 0x83, 0x62, 0x10, 0x83, 0x82, 0x10, 0x83, 0xA2, 0x10, 0x81, 0xC2, 0x10, 0x8A, 0x00,
+0x00, 0x82, 0x22, 0x10, 0x83, 0x42, 0x10, 0x83, 0x62, 0x10, 0x83, 0x82, 0x10, 0x83, 0xA2, 0x10,
+0x82, 0xC2, 0x10, 0x88, 0x00, 0x00, 0x83, 0x23, 0x10, 0x83, 0x43, 0x10, 0x83, 0x63, 0x10, 0x83,
+0x83, 0x10, 0x83, 0xA3, 0x10, 0x83, 0xC3, 0x10, 0x86, 0x00, 0x00, 0x00, 0x03, 0x10, 0x83, 0x23,
+0x10, 0x83, 0x43, 0x10, 0x83, 0x63, 0x10, 0x83, 0x83, 0x10, 0x83, 0xA3, 0x10, 0x83, 0xC3, 0x10,
+0x00, 0xE3, 0x10, 0x84, 0x00, 0x00, 0x81, 0x03, 0x10, 0x83, 0x23, 0x10, 0x83, 0x43, 0x10, 0x83,
+0x63, 0x10, 0x83, 0x83, 0x10, 0x83, 0xA3, 0x10, 0x83, 0xC3, 0x10, 0x81, 0xE3, 0x10, 0x82, 0x00,
+0x00, 0x82, 0x03, 0x10, 0x83, 0x23, 0x10, 0x83, 0x43, 0x10, 0x83, 0x63, 0x10, 0x83, 0x83, 0x10,
+0x83, 0xA3, 0x10, 0x83, 0xC3, 0x10, 0x82, 0xE3, 0x10, 0x81, 0x00, 0x00, 0x82, 0x04, 0x10, 0x83,
+0x24, 0x10, 0x83, 0x44, 0x10, 0x83, 0x64, 0x10, 0x83, 0x84, 0x10, 0x83, 0xA4, 0x10, 0x83, 0xC4,
+0x10, 0x82, 0xE4, 0x10, 0x82, 0x00, 0x00, 0x81, 0x04, 0x10, 0x83, 0x24, 0x10, 0x83, 0x44, 0x10,
+0x83, 0x64, 0x10, 0x83, 0x84, 0x10, 0x83, 0xA4, 0x10, 0x83, 0xC4, 0x10, 0x81, 0xE4, 0x10, 0x84,
+0x00, 0x00, 0x00, 0x04, 0x10, 0x83, 0x24, 0x10, 0x83, 0x44, 0x10, 0x83, 0x64, 0x10, 0x83, 0x84,
+0x10, 0x83, 0xA4, 0x10, 0x83, 0xC4, 0x10, 0x00, 0xE4, 0x10, 0x86, 0x00, 0x00, 0x83, 0x24, 0x10,
+0x83, 0x44, 0x10, 0x83, 0x64, 0x10, 0x83, 0x84, 0x10, 0x83, 0xA4, 0x10, 0x83, 0xC4, 0x10, 0x88,
+0x00, 0x00, 0x82, 0x25, 0x10, 0x83, 0x45, 0x10, 0x83, 0x65, 0x10, 0x83, 0x85, 0x10, 0x83, 0xA5,
+0x10, 0x82, 0xC5, 0x10, 0x8A, 0x00, 0x00, 0x81, 0x25, 0x10, 0x83, 0x45, 0x10, 0x83, 0x65, 0x10,
+0x83, 0x85, 0x10, 0x83, 0xA5, 0x10, 0x81, 0xC5, 0x10, 0x8C, 0x00, 0x00, 0x00, 0x25, 0x10, 0x83,
+0x45, 0x10, 0x83, 0x65, 0x10, 0x83, 0x85, 0x10, 0x83, 0xA5, 0x10, 0x00, 0xC5, 0x10, 0x8E, 0x00,
+0x00, 0x83, 0x45, 0x10, 0x83, 0x65, 0x10, 0x83, 0x85, 0x10, 0x83, 0xA5, 0x10, 0x90, 0x00, 0x00,
+0x82, 0x46, 0x10, 0x83, 0x66, 0x10, 0x83, 0x86, 0x10, 0x82, 0xA6, 0x10, 0x92, 0x00, 0x00, 0x81,
+0x46, 0x10, 0x83, 0x66, 0x10, 0x83, 0x86, 0x10, 0x81, 0xA6, 0x10, 0x94, 0x00, 0x00, 0x00, 0x46,
+0x10, 0x83, 0x66, 0x10, 0x83, 0x86, 0x10, 0x00, 0xA6, 0x10, 0x96, 0x00, 0x00, 0x83, 0x66, 0x10,
+0x83, 0x86, 0x10, 0x98, 0x00, 0x00, 0x82, 0x67, 0x10, 0x82, 0x87, 0x10, 0x9A, 0x00, 0x00, 0x81,
+0x67, 0x10, 0x81, 0x87, 0x10, 0x9C, 0x00, 0x00, 0x01, 0x67, 0x10, 0x87, 0x10, 0xAE, 0x00, 0x00,
+};
+
+
+// mono.ppm: 24x21, 1 bpp, 73 bytes (1008 as RGB565)
+const unsigned char bmMono[73] PROGMEM={
+0x01, 0x18, 0x00, 0x15, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xE0, 0x1C, 0x71, 0xC4, 0x1C, 0x71, 0xC4,
+0x1C, 0x71, 0xC4, 0x23, 0x8E, 0x38, 0x23, 0x8E, 0x38, 0x23, 0x8E, 0x38, 0x1C, 0x71, 0xC4, 0x1C,
+0x71, 0xC4, 0x1C, 0x71, 0xC4, 0x23, 0x8E, 0x38, 0x23, 0x8E, 0x38, 0x23, 0x8E, 0x38, 0x1C, 0x71,
+0xC4, 0x1C, 0x71, 0xC4, 0x1C, 0x71, 0xC4, 0x23, 0x8E, 0x38, 0x23, 0x8E, 0x38, 0x23, 0x8E, 0x38,
+0x1C, 0x71, 0xC4, 0x1C, 0x71, 0xC4, 0x1C, 0x71, 0xC4,
+};
+
+
+// bar.ppm: 60x12, 2 bpp, RLE, 94 bytes (1440 as RGB565)
+const unsigned char bmBar[94] PROGMEM={
+0x82, 0x3C, 0x00, 0x0C, 0x00, 0x03, 0x00, 0x00, 0x06, 0x40, 0xF8, 0x00, 0xFE, 0x40, 0xCB, 0x00,
+0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00, 0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00,
+0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00, 0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00,
+0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0xCB, 0x00, 0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00,
+0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00, 0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00,
+0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80, 0x8F, 0x00, 0x8F, 0x40, 0x8F, 0xC0, 0x8B, 0x80,
+};
+
@@ -134,8 +134,7 @@ CMAX31855 TSens5(31);
 CMAX31855 TSens6(33);
 
 // CGraph::CGraph(int x, int y, int w, int h, float x0, float xf, float y0, float yf, UTFT *tft)
-CGraph    TSens1Graph(50,0,  270,40,0,5.5,-1,1, &myGLCD);
-CGraph    TSens2Graph(50,0,  270,40,0,5.5,-1,1, &myGLCD);
+CGraph    TSens1Graph(50,0,  270,40,0,5.5,-1,1, &myGLCD);     // Two traces, TSens1 and TSens2
 CGraph    TSens3Graph(50,40, 270,40,0,10,-1,1, &myGLCD);
 CGraph    TSens4Graph(50,80, 270,40,0,2.5,-1,1, &myGLCD);
 CGraph    TSens5Graph(50,120,270,40,0,25, -1,1, &myGLCD);
@@ -147,6 +146,62 @@ CProgressBar PAPP  (50, 165+19, 320-50, 16, 0.0f, 100.0f, &myGLCD);
 
 uText     txtPlot(&myGLCD, 320, 240);
 
+// Layout changes are drawn as one frame: into the hidden page on the CPLD modules, so the
+// old screen stays until the new one is complete
+CFrame    layoutFrame(&myGLCD);
+
+// The readouts are queued by loop() and drawn from the 1 ms timer, about 128 pixels per tick
+CRenderQueue renderQueue(&myGLCD);
+
+static void drainDisplay()
+{
+  renderQueue.drain( 128 );
+}
+
+// The widget updates of a loop() pass are recorded and sent as one optimized display list,
+// room for 20 rectangles. A full list is sent and recording goes on.
+static byte widgetList[20 * ( 1 + 4 * sizeof(int) + sizeof(word) )];
+
+// The graphs and bars only mark what changed, loop() paints it once per pass in z-order.
+// The graphs composite their columns in 4 columns of the 37 pixel high plot areas.
+CDirtyRects dirtyRects(&myGLCD);
+static word graphBand[37 * 4];
+
+// The curves of the graphs, so a layout change draws them again. TSens1Graph keeps two
+// samples per plot column and trace and is drawn again as it was, the auto-range graphs
+// one, enough to shrink their range.
+static graphSample graphHistory[( 2 * 2 + 3 ) * ( 270 - 2 )];
+
+// Free RAM between the heap and the stack, left for the timer drain and the float and
+// sprintf work of loop()
+static int freeRam()
+{
+  extern int __heap_start, *__brkval;
+  int v;
+
+  return (int)&v - ( __brkval == 0 ? (int)&__heap_start : (int)__brkval );
+}
+
+// Static parts of the screen, redrawn completely for every frame
+static void drawLayout( void *owner, int x1, int y1, int x2, int y2 )
+{
+  myGLCD.clrScr();
+
+  TSens1Graph.redrawAxis();
+  TSens3Graph.redrawAxis();
+  TSens4Graph.redrawAxis();
+  TSens5Graph.redrawAxis();
+
+  PBoost.redraw();
+  PAPP.redraw();
+
+  txtPlot.setFont(LucidaConsole10a);
+  txtPlot.print(0, 165, "Ladedr", NULL );
+  txtPlot.print(0, 165+19, "Gasped", NULL );
+  txtPlot.print(0, 165+38, "EngRPMABCDEFGHIJKLMNOPQRSTUVWXYZ01234", NULL );
+  txtPlot.print(0, 165+57, "OilPrsabcdefghijklmnopqrstuvwxyz56789", NULL );
+}
+
 void setup()
 {
   randomSeed(analogRead(0));
@@ -156,28 +211,16 @@ void setup()
   
   delay(5);
   
-  myGLCD.clrScr();
-  
-  TSens2Graph.setLineColor(0,255,0);
+  TSens1Graph.addTrace(0,255,0);
   TSens3Graph.setLineColor(0,0,255);
   TSens4Graph.setLineColor(0,255,255);  
 
   TSens1Graph.setEraserPixelWidth(40);  
-  TSens2Graph.setEraserPixelWidth(40);  
   TSens3Graph.setEraserPixelWidth(30);
   TSens5Graph.setEraserPixelWidth(25);
   
-  // Only once or on display change
-  TSens1Graph.redrawAxis();
-  TSens2Graph.redrawAxis();  
-  TSens3Graph.redrawAxis();
-  TSens4Graph.redrawAxis();
-  TSens5Graph.redrawAxis();
-  
   PBoost.setBaseValue( 20.0f );
-  PBoost.redraw();
   PAPP.setMaxAlert( 90.0f );
-  PAPP.redraw();
   
   TSens1Graph.setXGridInterval( 0.5f );  
   TSens1Graph.setYGridInterval( 0.5f );
@@ -185,10 +228,31 @@ void setup()
   TSens5Graph.setXGridInterval( 2.5f );
 
   TSens1Graph.setCursor(true);
-  TSens2Graph.setCursor(true);
   TSens3Graph.setCursor(true);
   TSens4Graph.setCursor(true);
   TSens5Graph.setCursor(true);
+
+  TSens1Graph.setDirtyRects( &dirtyRects );
+  TSens3Graph.setDirtyRects( &dirtyRects );
+  TSens4Graph.setDirtyRects( &dirtyRects );
+  TSens5Graph.setDirtyRects( &dirtyRects );
+  PBoost.setDirtyRects( &dirtyRects );
+  PAPP.setDirtyRects( &dirtyRects );
+
+  TSens1Graph.setHistoryBuffer( graphHistory, 2 * 2 * ( 270 - 2 ) );
+  TSens3Graph.setHistoryBuffer( graphHistory + 4 * ( 270 - 2 ), 270 - 2 );
+  TSens4Graph.setHistoryBuffer( graphHistory + 5 * ( 270 - 2 ), 270 - 2 );
+  TSens5Graph.setHistoryBuffer( graphHistory + 6 * ( 270 - 2 ), 270 - 2 );
+
+  // The range follows the sensors, TSens1Graph keeps its axis
+  TSens3Graph.setAutoRange( true, 0.5f );
+  TSens4Graph.setAutoRange( true, 0.5f );
+  TSens5Graph.setAutoRange( true, 0.5f );
+
+  TSens1Graph.setBandBuffer( graphBand, 37 * 4 );
+  TSens3Graph.setBandBuffer( graphBand, 37 * 4 );
+  TSens4Graph.setBandBuffer( graphBand, 37 * 4 );
+  TSens5Graph.setBandBuffer( graphBand, 37 * 4 );
   
   
   /*myGLCD.setFont(arial_bold);
@@ -199,13 +263,15 @@ void setup()
   myGLCD.print("OilPrs", 0, 165+57 );*/
   
   
-  txtPlot.setFont(LucidaConsole10a);
-  txtPlot.print(0, 165, "Ladedr", NULL );
-  txtPlot.print(0, 165+19, "Gasped", NULL );
-  txtPlot.print(0, 165+38, "EngRPMABCDEFGHIJKLMNOPQRSTUVWXYZ01234", NULL );
-  txtPlot.print(0, 165+57, "OilPrsabcdefghijklmnopqrstuvwxyz56789", NULL );
+  // Only once or on display change
+  layoutFrame.draw( drawLayout, NULL );
+  
+  MsTimer2::set( 1, drainDisplay );
+  MsTimer2::start();
   
   Serial.begin(115200);
+  Serial.print( F("Free RAM: ") );
+  Serial.println( freeRam() );
 }
 
 void loop()
@@ -228,32 +294,39 @@ void loop()
   
 //  Serial.println(y);
   
-  TSens1Graph.addData((float)t/1000.0f, y );
-  TSens2Graph.addData((float)t/1000.0f, y*y );
+  // The widgets draw directly, the timer has to wait
+  renderQueue.suspend();
+  myGLCD.beginList( widgetList, sizeof(widgetList) );
+  float TSens12[2] = { y, y*y };
+  TSens1Graph.addData((float)t/1000.0f, TSens12 );
   TSens3Graph.addData((float)t/1000.0f, y );
   TSens4Graph.addData((float)t/1000.0f, 0.7*y );
   TSens5Graph.addData((float)t/1000.0f, 0.9f*y );
   
   PAPP.update(z*100.0f);
   PBoost.update(z*z*100.0f);
+
+  dirtyRects.paint();
+  myGLCD.endList();
+  renderQueue.resume();
   
   // Soft timer
   if( t - tmrTxtUpdate1 > 200 )
   {
-    myGLCD.setFont(SmallFont);
-    myGLCD.setColor( 0, 255, 0 );
-    myGLCD.printNumF( y, 2, 0, 0, ',', 5, ' ' );
-    myGLCD.setColor( 0, 0, 255 );
-    myGLCD.printNumF( y, 2, 0, 40, ',', 5, ' ' );
+    renderQueue.setFont(SmallFont);
+    renderQueue.setColor( 0, 255, 0 );
+    renderQueue.printNumF( y, 2, 0, 0, ',', 5, ' ' );
+    renderQueue.setColor( 0, 0, 255 );
+    renderQueue.printNumF( y, 2, 0, 40, ',', 5, ' ' );
     tmrTxtUpdate1 = t;
   }
   if( t - tmrTxtUpdate2 > 555 )
   {  
-    myGLCD.setFont(SmallFont);
-    myGLCD.setColor( 0, 255, 255 );
-    myGLCD.printNumF( y, 2, 0, 80, ',', 5, ' ' );
-    myGLCD.setColor( 255, 0, 0 );
-    myGLCD.printNumF( y, 2, 0, 120, ',', 5, ' ' );
+    renderQueue.setFont(SmallFont);
+    renderQueue.setColor( 0, 255, 255 );
+    renderQueue.printNumF( y, 2, 0, 80, ',', 5, ' ' );
+    renderQueue.setColor( 255, 0, 0 );
+    renderQueue.printNumF( y, 2, 0, 120, ',', 5, ' ' );
     tmrTxtUpdate2 = t;
   }
   